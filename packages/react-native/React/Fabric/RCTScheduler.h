@@ -7,6 +7,7 @@
 
 #import <UIKit/UIKit.h>
 #import <memory>
+#import <vector>
 
 #import <react/renderer/componentregistry/ComponentDescriptorFactory.h>
 #import <react/renderer/core/ComponentDescriptor.h>
@@ -69,6 +70,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)reportMount:(facebook::react::SurfaceId)surfaceId;
 
+- (void)reportMounts:(const std::vector<facebook::react::SurfaceId> &)surfaceIds;
+
 - (void)addEventListener:(const std::shared_ptr<facebook::react::EventListener> &)listener;
 
 - (void)removeEventListener:(const std::shared_ptr<facebook::react::EventListener> &)listener;
@@ -147,6 +147,11 @@ class LayoutAnimationDelegateProxy : public LayoutAnimationStatusDelegate, publi
   _scheduler->reportMount(surfaceId);
 }
 
+- (void)reportMounts:(const std::vector<facebook::react::SurfaceId> &)surfaceIds
+{
+  _scheduler->reportMounts(surfaceIds);
+}
+
 - (void)dealloc
 {
   if (_animationDriver) {
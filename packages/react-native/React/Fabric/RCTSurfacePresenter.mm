@@ -9,6 +9,7 @@
 
 #import <mutex>
 #import <shared_mutex>
+#import <vector>
 
 #import <React/RCTAssert.h>
 #import <React/RCTBridge+Private.h>
@@ -59,6 +60,8 @@ using namespace facebook::react;
 
   std::shared_mutex _observerListMutex;
   std::vector<__weak id<RCTSurfacePresenterObserver>> _observers; // Protected by `_observerListMutex`.
+
+  std::vector<SurfaceId> _mountedSurfaceIds; // Only accessed on the main queue.
 }
 
 - (instancetype)initWithContextContainer:(ContextContainer::Shared)contextContainer
@@ -389,13 +392,33 @@ using namespace facebook::react;
     }
   }
 
+  if (std::find(_mountedSurfaceIds.begin(), _mountedSurfaceIds.end(), rootTag) != _mountedSurfaceIds.end()) {
+    return;
+  }
+
+  _mountedSurfaceIds.push_back(rootTag);
+  if (_mountedSurfaceIds.size() > 1) {
+    // The surfaces mounted in the same run loop iteration are reported
+    // together, so mount hooks run once for all of them.
+    return;
+  }
+
   RCTScheduler *scheduler = [self scheduler];
   if (scheduler) {
     // Notify mount when the effects are visible and prevent mount hooks to
     // delay paint.
+    __weak RCTSurfacePresenter *weakSelf = self;
     dispatch_async(dispatch_get_main_queue(), ^{
-      [scheduler reportMount:rootTag];
+      RCTSurfacePresenter *strongSelf = weakSelf;
+      if (!strongSelf) {
+        return;
+      }
+      auto surfaceIds = std::move(strongSelf->_mountedSurfaceIds);
+      strongSelf->_mountedSurfaceIds.clear();
+      [scheduler reportMounts:surfaceIds];
     });
+  } else {
+    _mountedSurfaceIds.clear();
   }
 }
 
@@ -53,6 +53,8 @@ public interface Binding {
 
   public fun reportMount(surfaceId: Int)
 
+  public fun reportMounts(surfaceIds: IntArray)
+
   public fun getInspectorDataForInstance(
       eventEmitterWrapper: EventEmitterWrapper?
   ): ReadableNativeMap?
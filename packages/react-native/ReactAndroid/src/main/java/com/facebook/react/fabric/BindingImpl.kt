@@ -71,6 +71,8 @@ public class BindingImpl : Binding {
 
   external override fun reportMount(surfaceId: Int)
 
+  external override fun reportMounts(surfaceIds: IntArray)
+
   external override fun getInspectorDataForInstance(
       eventEmitterWrapper: EventEmitterWrapper?
   ): ReadableNativeMap?
@@ -1278,9 +1278,12 @@ public class FabricUIManager
                       return;
                     }
 
-                    for (int surfaceId : mMountedSurfaceIds) {
-                      binding.reportMount(surfaceId);
+                    // Mount hooks are notified once for all the surfaces.
+                    int[] surfaceIds = new int[mMountedSurfaceIds.size()];
+                    for (int i = 0; i < surfaceIds.length; i++) {
+                      surfaceIds[i] = mMountedSurfaceIds.get(i);
                     }
+                    binding.reportMounts(surfaceIds);
 
                     mMountedSurfaceIds.clear();
                   }
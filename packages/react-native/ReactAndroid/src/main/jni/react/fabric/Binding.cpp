@@ -102,6 +102,22 @@ void Binding::drainPreallocateViewsQueue() {
 }
 
 void Binding::reportMount(SurfaceId surfaceId) {
+  reportMountedSurfaces({surfaceId});
+}
+
+void Binding::reportMounts(jni::alias_ref<jni::JArrayInt> surfaceIds) {
+  auto pinnedSurfaceIds = surfaceIds->pin();
+
+  auto mountedSurfaceIds = std::vector<SurfaceId>{};
+  mountedSurfaceIds.reserve(pinnedSurfaceIds.size());
+  for (size_t i = 0; i < pinnedSurfaceIds.size(); i++) {
+    mountedSurfaceIds.push_back(pinnedSurfaceIds[i]);
+  }
+
+  reportMountedSurfaces(mountedSurfaceIds);
+}
+
+void Binding::reportMountedSurfaces(const std::vector<SurfaceId>& surfaceIds) {
   if (ReactNativeFeatureFlags::
           fixMountingCoordinatorReportedPendingTransactionsOnAndroid()) {
     // This is a fix for `MountingCoordinator::hasPendingTransactions` on
@@ -110,10 +126,12 @@ void Binding::reportMount(SurfaceId surfaceId) {
     // removed when we migrate to a pull model.
     std::shared_lock lock(surfaceHandlerRegistryMutex_);
 
-    auto iterator = surfaceHandlerRegistry_.find(surfaceId);
-    if (iterator != surfaceHandlerRegistry_.end()) {
-      auto& surfaceHandler = iterator->second;
-      surfaceHandler.getMountingCoordinator()->didPerformAsyncTransactions();
+    for (auto surfaceId : surfaceIds) {
+      auto iterator = surfaceHandlerRegistry_.find(surfaceId);
+      if (iterator != surfaceHandlerRegistry_.end()) {
+        auto& surfaceHandler = iterator->second;
+        surfaceHandler.getMountingCoordinator()->didPerformAsyncTransactions();
+      }
     }
   }
 
@@ -122,7 +140,7 @@ void Binding::reportMount(SurfaceId surfaceId) {
     LOG(ERROR) << "Binding::reportMount: scheduler disappeared";
     return;
   }
-  scheduler->reportMount(surfaceId);
+  scheduler->reportMounts(surfaceIds);
 }
 
 #pragma mark - Surface management
@@ -599,6 +617,7 @@ void Binding::registerNatives() {
       makeNativeMethod(
           "drainPreallocateViewsQueue", Binding::drainPreallocateViewsQueue),
       makeNativeMethod("reportMount", Binding::reportMount),
+      makeNativeMethod("reportMounts", Binding::reportMounts),
       makeNativeMethod(
           "uninstallFabricUIManager", Binding::uninstallFabricUIManager),
       makeNativeMethod("registerSurface", Binding::registerSurface),
@@ -11,6 +11,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <fbjni/fbjni.h>
 #include <react/jni/JRuntimeExecutor.h>
@@ -130,6 +131,10 @@ class Binding : public jni::HybridClass<Binding, JBinding>,
 
   void reportMount(SurfaceId surfaceId);
 
+  void reportMounts(jni::alias_ref<jni::JArrayInt> surfaceIds);
+
+  void reportMountedSurfaces(const std::vector<SurfaceId>& surfaceIds);
+
   void uninstallFabricUIManager();
 
   // Private member variables
@@ -91,7 +91,7 @@ JReactInstance::JReactInstance(
 
   auto unbufferedRuntimeExecutor = instance_->getUnbufferedRuntimeExecutor();
   // Set up the JS and native modules call invokers (for TurboModules)
-  auto jsInvoker = std::make_unique<RuntimeSchedulerCallInvoker>(
+  auto jsInvoker = createBatchingRuntimeSchedulerCallInvoker(
       instance_->getRuntimeScheduler());
   jsCallInvokerHolder_ = jni::make_global(
       CallInvokerHolder::newObjectCxxArgs(std::move(jsInvoker)));
@@ -43,9 +43,35 @@ void RAMBundleRegistry::registerBundle(
   m_bundlePaths.emplace(bundleId, std::move(bundlePath));
 }
 
+void RAMBundleRegistry::prefetchBundle(uint32_t bundleId) {
+  if (!m_factory || m_bundles.find(bundleId) != m_bundles.end() ||
+      m_prefetchedBundles.find(bundleId) != m_prefetchedBundles.end()) {
+    return;
+  }
+
+  auto bundlePath = m_bundlePaths.find(bundleId);
+  if (bundlePath == m_bundlePaths.end()) {
+    return;
+  }
+
+  m_prefetchedBundles.emplace(
+      bundleId,
+      std::async(std::launch::async, m_factory, bundlePath->second));
+}
+
 JSModulesUnbundle::Module RAMBundleRegistry::getModule(
     uint32_t bundleId,
     uint32_t moduleId) {
+  if (m_bundles.find(bundleId) == m_bundles.end()) {
+    auto prefetchedBundle = m_prefetchedBundles.find(bundleId);
+    if (prefetchedBundle != m_prefetchedBundles.end()) {
+      auto future = std::move(prefetchedBundle->second);
+      m_prefetchedBundles.erase(prefetchedBundle);
+      // Rethrows if the factory failed in the background.
+      m_bundles.emplace(bundleId, future.get());
+    }
+  }
+
   if (m_bundles.find(bundleId) == m_bundles.end()) {
     if (!m_factory) {
       throw std::runtime_error(
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +41,14 @@ class RN_EXPORT RAMBundleRegistry {
   RAMBundleRegistry& operator=(RAMBundleRegistry&&) = default;
 
   void registerBundle(uint32_t bundleId, std::string bundlePath);
+
+  /**
+   * Constructs a registered bundle, including parsing its module table, on a
+   * background thread, so that the first `getModule` call for it doesn't do
+   * the I/O on the JS thread. Must be called on the thread that calls
+   * `getModule`; the factory has to be safe to call from another thread.
+   */
+  void prefetchBundle(uint32_t bundleId);
   JSModulesUnbundle::Module getModule(uint32_t bundleId, uint32_t moduleId);
   virtual ~RAMBundleRegistry(){};
 
@@ -49,6 +58,8 @@ class RN_EXPORT RAMBundleRegistry {
   std::function<std::unique_ptr<JSModulesUnbundle>(std::string)> m_factory;
   std::unordered_map<uint32_t, std::string> m_bundlePaths;
   std::unordered_map<uint32_t, std::unique_ptr<JSModulesUnbundle>> m_bundles;
+  std::unordered_map<uint32_t, std::future<std::unique_ptr<JSModulesUnbundle>>>
+      m_prefetchedBundles;
 };
 
 } // namespace facebook::react
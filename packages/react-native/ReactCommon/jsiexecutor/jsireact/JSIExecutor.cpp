@@ -200,6 +200,9 @@ void JSIExecutor::registerBundle(
       ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
   if (bundleRegistry_) {
     bundleRegistry_->registerBundle(bundleId, bundlePath);
+    // Parse the module table off the JS thread while JS keeps running; the
+    // first `require` from this bundle waits for it if it is still pending.
+    bundleRegistry_->prefetchBundle(bundleId);
   } else {
     auto script = JSBigFileString::fromPath(bundlePath);
     if (script->size() == 0) {
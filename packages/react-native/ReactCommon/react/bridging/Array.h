@@ -8,6 +8,7 @@
 #pragma once
 
 #include <react/bridging/Base.h>
+#include <react/bridging/TypedArray.h>
 
 #include <array>
 #include <deque>
@@ -114,8 +115,17 @@ struct Bridging<std::vector<T>>
     : array_detail::BridgingDynamic<std::vector<T>> {
   static std::vector<T> fromJs(
       facebook::jsi::Runtime& rt,
-      const jsi::Array& array,
+      const jsi::Object& object,
       const std::shared_ptr<CallInvoker>& jsInvoker) {
+    if constexpr (typed_array_detail::is_typed_array_element_v<T>) {
+      // Numeric vectors also accept typed arrays of the matching element
+      // type, which are copied in one go instead of element by element.
+      if (!object.isArray(rt)) {
+        return typed_array_detail::copyFromTypedArray<T>(rt, object);
+      }
+    }
+
+    auto array = object.asArray(rt);
     size_t length = array.length(rt);
 
     std::vector<T> vector;
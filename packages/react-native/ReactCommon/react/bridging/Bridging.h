@@ -18,4 +18,5 @@
 #include <react/bridging/Number.h>
 #include <react/bridging/Object.h>
 #include <react/bridging/Promise.h>
+#include <react/bridging/TypedArray.h>
 #include <react/bridging/Value.h>
@@ -31,27 +31,58 @@ LongLivedObjectCollection& LongLivedObjectCollection::get(
 
 void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) {
   std::scoped_lock lock(collectionMutex_);
-  collection_.insert(std::move(so));
+  size_t slot;
+  if (freeSlots_.empty()) {
+    slot = slots_.size();
+    slots_.emplace_back();
+  } else {
+    slot = freeSlots_.back();
+    freeSlots_.pop_back();
+  }
+  so->slot_.store(slot, std::memory_order_relaxed);
+  slots_[slot] = std::move(so);
+  size_++;
 }
 
 void LongLivedObjectCollection::remove(const LongLivedObject* o) {
-  std::scoped_lock lock(collectionMutex_);
-  for (auto p = collection_.begin(); p != collection_.end(); p++) {
-    if (p->get() == o) {
-      collection_.erase(p);
-      break;
+  std::shared_ptr<LongLivedObject> removed;
+  {
+    std::scoped_lock lock(collectionMutex_);
+    auto slot = o->slot_.load(std::memory_order_relaxed);
+    if (slot >= slots_.size() || slots_[slot].get() != o) {
+      // The object was added to another collection after this one (or never
+      // was part of it); fall back to a scan.
+      slot = slots_.size();
+      for (size_t i = 0; i < slots_.size(); i++) {
+        if (slots_[i].get() == o) {
+          slot = i;
+          break;
+        }
+      }
+      if (slot == slots_.size()) {
+        return;
+      }
     }
+    removed = std::move(slots_[slot]);
+    freeSlots_.push_back(slot);
+    size_--;
   }
+  // `removed` may be the last owner; destroy it outside of the lock.
 }
 
 void LongLivedObjectCollection::clear() {
-  std::scoped_lock lock(collectionMutex_);
-  collection_.clear();
+  std::vector<std::shared_ptr<LongLivedObject>> slots;
+  {
+    std::scoped_lock lock(collectionMutex_);
+    slots.swap(slots_);
+    freeSlots_.clear();
+    size_ = 0;
+  }
 }
 
 size_t LongLivedObjectCollection::size() const {
   std::scoped_lock lock(collectionMutex_);
-  return collection_.size();
+  return size_;
 }
 
 // LongLivedObject
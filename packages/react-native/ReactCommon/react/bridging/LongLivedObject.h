@@ -8,9 +8,11 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
-#include <unordered_set>
+#include <vector>
 
 namespace facebook::react {
 
@@ -35,10 +37,22 @@ class LongLivedObject {
   explicit LongLivedObject(jsi::Runtime& runtime) : runtime_(runtime) {}
   virtual ~LongLivedObject() = default;
   jsi::Runtime& runtime_;
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  /*
+   * Slot of this object in the last collection it was added to. Only a hint:
+   * the collection validates it before use. Atomic because collections of
+   * different runtimes lock different mutexes.
+   */
+  std::atomic<size_t> slot_{std::numeric_limits<size_t>::max()};
 };
 
 /**
  * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ * Objects are kept in a slot table with a free list, so adding and removing
+ * an object doesn't hash or allocate in steady state.
  */
 class LongLivedObjectCollection {
  public:
@@ -54,7 +68,9 @@ class LongLivedObjectCollection {
   size_t size() const;
 
  private:
-  std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
+  std::vector<std::shared_ptr<LongLivedObject>> slots_;
+  std::vector<size_t> freeSlots_;
+  size_t size_{0};
   mutable std::mutex collectionMutex_;
 };
 
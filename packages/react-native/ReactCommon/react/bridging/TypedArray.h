@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+namespace typed_array_detail {
+
+template <typename T>
+struct TypedArrayTraits;
+
+template <>
+struct TypedArrayTraits<int8_t> {
+  static constexpr const char* constructorName = "Int8Array";
+};
+
+template <>
+struct TypedArrayTraits<uint8_t> {
+  static constexpr const char* constructorName = "Uint8Array";
+};
+
+template <>
+struct TypedArrayTraits<int16_t> {
+  static constexpr const char* constructorName = "Int16Array";
+};
+
+template <>
+struct TypedArrayTraits<uint16_t> {
+  static constexpr const char* constructorName = "Uint16Array";
+};
+
+template <>
+struct TypedArrayTraits<int32_t> {
+  static constexpr const char* constructorName = "Int32Array";
+};
+
+template <>
+struct TypedArrayTraits<uint32_t> {
+  static constexpr const char* constructorName = "Uint32Array";
+};
+
+template <>
+struct TypedArrayTraits<float> {
+  static constexpr const char* constructorName = "Float32Array";
+};
+
+template <>
+struct TypedArrayTraits<double> {
+  static constexpr const char* constructorName = "Float64Array";
+};
+
+template <typename T, typename = void>
+inline constexpr bool is_typed_array_element_v = false;
+
+template <typename T>
+inline constexpr bool is_typed_array_element_v<
+    T,
+    std::void_t<decltype(TypedArrayTraits<T>::constructorName)>> = true;
+
+/*
+ * `jsi::MutableBuffer` that owns the storage of a `std::vector`, so the
+ * vector can be exposed to JS as an `ArrayBuffer` without copying.
+ */
+template <typename T>
+class VectorBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorBuffer(std::vector<T> values) : values_(std::move(values)) {}
+
+  size_t size() const override {
+    return values_.size() * sizeof(T);
+  }
+
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(values_.data());
+  }
+
+ private:
+  std::vector<T> values_;
+};
+
+template <typename T>
+jsi::Object createTypedArray(jsi::Runtime& rt, std::vector<T> values) {
+  auto length = values.size();
+  auto arrayBuffer = jsi::ArrayBuffer(
+      rt, std::make_shared<VectorBuffer<T>>(std::move(values)));
+  return rt.global()
+      .getPropertyAsFunction(rt, TypedArrayTraits<T>::constructorName)
+      .callAsConstructor(rt, std::move(arrayBuffer), 0, (double)length)
+      .asObject(rt);
+}
+
+/*
+ * Copies the contents of a JS typed array whose element type matches `T`
+ * with a single `memcpy`. Throws `jsi::JSError` for any other object.
+ */
+template <typename T>
+std::vector<T> copyFromTypedArray(jsi::Runtime& rt, const jsi::Object& object) {
+  auto constructorName = TypedArrayTraits<T>::constructorName;
+  auto constructor = rt.global().getPropertyAsFunction(rt, constructorName);
+  if (!object.instanceOf(rt, constructor)) {
+    throw jsi::JSError(
+        rt, std::string("Expected an Array or ") + constructorName);
+  }
+
+  auto arrayBuffer =
+      object.getPropertyAsObject(rt, "buffer").getArrayBuffer(rt);
+  auto byteOffset =
+      static_cast<size_t>(object.getProperty(rt, "byteOffset").asNumber());
+  auto byteLength =
+      static_cast<size_t>(object.getProperty(rt, "byteLength").asNumber());
+
+  std::vector<T> result(byteLength / sizeof(T));
+  if (byteLength > 0) {
+    std::memcpy(result.data(), arrayBuffer.data(rt) + byteOffset, byteLength);
+  }
+  return result;
+}
+
+} // namespace typed_array_detail
+
+/*
+ * Contiguous numeric data that is bridged to JS as a typed array
+ * (`Float32Array`, `Float64Array`, `Int32Array`, ...) instead of a plain
+ * `Array`. Converting an rvalue to JS hands the storage over to the
+ * resulting `ArrayBuffer` without copying; converting from JS copies the
+ * typed array contents with a single `memcpy`.
+ */
+template <typename T>
+class TypedArray {
+  static_assert(
+      typed_array_detail::is_typed_array_element_v<T>,
+      "TypedArray element type has no JS typed array equivalent");
+
+ public:
+  TypedArray() = default;
+  TypedArray(std::vector<T> values) : values_(std::move(values)) {}
+
+  const std::vector<T>& values() const& {
+    return values_;
+  }
+
+  std::vector<T> values() && {
+    return std::move(values_);
+  }
+
+  size_t size() const {
+    return values_.size();
+  }
+
+  const T* data() const {
+    return values_.data();
+  }
+
+  bool operator==(const TypedArray& rhs) const {
+    return values_ == rhs.values_;
+  }
+
+ private:
+  std::vector<T> values_;
+};
+
+template <typename T>
+struct Bridging<TypedArray<T>> {
+  static TypedArray<T> fromJs(jsi::Runtime& rt, const jsi::Object& object) {
+    if (object.isArray(rt)) {
+      auto array = object.getArray(rt);
+      auto length = array.length(rt);
+      std::vector<T> values;
+      values.reserve(length);
+      for (size_t i = 0; i < length; i++) {
+        values.push_back(
+            static_cast<T>(array.getValueAtIndex(rt, i).asNumber()));
+      }
+      return TypedArray<T>(std::move(values));
+    }
+    return TypedArray<T>(
+        typed_array_detail::copyFromTypedArray<T>(rt, object));
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, TypedArray<T> value) {
+    return typed_array_detail::createTypedArray<T>(
+        rt, std::move(value).values());
+  }
+};
+
+} // namespace facebook::react
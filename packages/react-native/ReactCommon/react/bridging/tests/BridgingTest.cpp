@@ -195,6 +195,39 @@ TEST_F(BridgingTest, arrayTest) {
   EXPECT_EQ(headers.size(), jsiHeaders.size(rt));
 }
 
+TEST_F(BridgingTest, typedArrayTest) {
+  auto values = std::vector<double>{1.5, -2.25, 3};
+
+  auto float64Array = bridging::toJs(rt, TypedArray<double>(values), invoker);
+  EXPECT_TRUE(float64Array.instanceOf(
+      rt, rt.global().getPropertyAsFunction(rt, "Float64Array")));
+  EXPECT_EQ(3, float64Array.getProperty(rt, "length").asNumber());
+  EXPECT_EQ(-2.25, float64Array.getProperty(rt, "1").asNumber());
+
+  // Typed arrays round-trip through both TypedArray and std::vector.
+  EXPECT_EQ(
+      values,
+      bridging::fromJs<TypedArray<double>>(rt, float64Array, invoker)
+          .values());
+  EXPECT_EQ(
+      values,
+      bridging::fromJs<std::vector<double>>(rt, float64Array, invoker));
+
+  // Views into a larger buffer only copy the viewed range.
+  auto int32Array = eval("new Int32Array([1, 2, 3, 4]).subarray(1, 3)");
+  EXPECT_EQ(
+      std::vector<int32_t>({2, 3}),
+      bridging::fromJs<std::vector<int32_t>>(rt, int32Array, invoker));
+
+  // Plain arrays are still accepted, mismatched typed arrays are not.
+  auto array = jsi::Array::createWithElements(rt, 1, 2);
+  EXPECT_EQ(
+      std::vector<float>({1, 2}),
+      bridging::fromJs<TypedArray<float>>(rt, array, invoker).values());
+  EXPECT_JSI_THROW(
+      bridging::fromJs<std::vector<float>>(rt, float64Array, invoker));
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
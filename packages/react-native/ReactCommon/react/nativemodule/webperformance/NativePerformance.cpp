@@ -15,6 +15,8 @@
 #include <cxxreact/ReactMarker.h>
 #include <jsi/instrumentation.h>
 #include <react/performance/timeline/PerformanceEntryReporter.h>
+#include <react/renderer/mounting/ShadowTreeMemoryUsage.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
 #include <reactperflogger/fusebox/FuseboxTracer.h>
 #include "NativePerformance.h"
 #include "Plugins.h"
@@ -65,6 +67,10 @@ std::tuple<std::string, std::string_view> parseTrackName(
   return std::make_tuple(trackNameRef, eventName);
 }
 
+std::string getSurfaceMemoryInfoKey(SurfaceId surfaceId) {
+  return "fabric_surface_" + std::to_string(surfaceId) + "_totalSize";
+}
+
 } // namespace
 
 NativePerformance::NativePerformance(std::shared_ptr<CallInvoker> jsInvoker)
@@ -135,6 +141,33 @@ std::unordered_map<std::string, double> NativePerformance::getSimpleMemoryInfo(
   for (auto& entry : heapInfo) {
     heapInfoToJs[entry.first] = static_cast<double>(entry.second);
   }
+
+  // Memory retained by the shadow trees of the renderer, in total and per
+  // surface, to find out which surface is responsible for high usage.
+  if (auto uiManagerBinding = UIManagerBinding::getBinding(rt)) {
+    auto totalUsage = ShadowTreeMemoryUsage{};
+    uiManagerBinding->getUIManager().getShadowTreeRegistry().enumerate(
+        [&](const ShadowTree& shadowTree, bool& /*stop*/) {
+          auto usage = estimateMemoryUsage(shadowTree);
+          heapInfoToJs[getSurfaceMemoryInfoKey(shadowTree.getSurfaceId())] =
+              static_cast<double>(usage.getTotalSize());
+          totalUsage += usage;
+        });
+
+    heapInfoToJs["fabric_shadowNodeCount"] =
+        static_cast<double>(totalUsage.shadowNodeCount);
+    heapInfoToJs["fabric_sharedShadowNodeCount"] =
+        static_cast<double>(totalUsage.sharedShadowNodeCount);
+    heapInfoToJs["fabric_shadowNodesSize"] =
+        static_cast<double>(totalUsage.shadowNodesSize);
+    heapInfoToJs["fabric_propsSize"] =
+        static_cast<double>(totalUsage.propsSize);
+    heapInfoToJs["fabric_stateSize"] =
+        static_cast<double>(totalUsage.stateSize);
+    heapInfoToJs["fabric_totalSize"] =
+        static_cast<double>(totalUsage.getTotalSize());
+  }
+
   return heapInfoToJs;
 }
 
@@ -55,9 +55,26 @@ void NativePerformanceObserver::setIsBuffered(
   }
 }
 
-PerformanceEntryReporter::PopPendingEntriesResult
-NativePerformanceObserver::popPendingEntries(jsi::Runtime& /*rt*/) {
-  return PerformanceEntryReporter::getInstance()->popPendingEntries();
+jsi::Object NativePerformanceObserver::popPendingEntries(jsi::Runtime& rt) {
+  // Entries are copied out (names are shared, not copied) so JS objects are
+  // created without blocking the threads reporting new entries.
+  auto pendingEntries =
+      PerformanceEntryReporter::getInstance()->popPendingEntries();
+  const auto& entries = pendingEntries.entries;
+
+  auto jsEntries = jsi::Array(rt, entries.size());
+  for (size_t i = 0; i < entries.size(); i++) {
+    jsEntries.setValueAtIndex(
+        rt, i, bridging::toJs(rt, entries[i], jsInvoker_));
+  }
+
+  auto result = jsi::Object(rt);
+  result.setProperty(rt, "entries", std::move(jsEntries));
+  result.setProperty(
+      rt,
+      "droppedEntriesCount",
+      static_cast<int>(pendingEntries.droppedEntriesCount));
+  return result;
 }
 
 void NativePerformanceObserver::setOnPerformanceEntryCallback(
@@ -83,8 +100,12 @@ std::vector<std::pair<std::string, uint32_t>>
 NativePerformanceObserver::getEventCounts(jsi::Runtime& /*rt*/) {
   const auto& eventCounts =
       PerformanceEntryReporter::getInstance()->getEventCounts();
-  return std::vector<std::pair<std::string, uint32_t>>(
-      eventCounts.begin(), eventCounts.end());
+  auto result = std::vector<std::pair<std::string, uint32_t>>{};
+  result.reserve(eventCounts.size());
+  for (const auto& [name, count] : eventCounts) {
+    result.emplace_back(name.str(), count);
+  }
+  return result;
 }
 
 void NativePerformanceObserver::setDurationThreshold(
@@ -122,6 +143,7 @@ NativePerformanceObserver::getSupportedPerformanceEntryTypes(
 
   if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
     supportedEntries.push_back(PerformanceEntryType::LONGTASK);
+    supportedEntries.push_back(PerformanceEntryType::STALL);
   }
 
   return supportedEntries;
@@ -33,13 +33,23 @@ struct Bridging<PerformanceEntryType> {
 };
 
 template <>
-struct Bridging<PerformanceEntry>
-    : NativePerformanceObserverRawPerformanceEntryBridging<PerformanceEntry> {};
+struct Bridging<PerformanceEntryName> {
+  static PerformanceEntryName fromJs(
+      jsi::Runtime& rt,
+      const jsi::String& value) {
+    return PerformanceEntryName{value.utf8(rt)};
+  }
+
+  static jsi::String toJs(
+      jsi::Runtime& rt,
+      const PerformanceEntryName& value) {
+    return jsi::String::createFromUtf8(rt, value.str());
+  }
+};
 
 template <>
-struct Bridging<PerformanceEntryReporter::PopPendingEntriesResult>
-    : NativePerformanceObserverGetPendingEntriesResultBridging<
-          PerformanceEntryReporter::PopPendingEntriesResult> {};
+struct Bridging<PerformanceEntry>
+    : NativePerformanceObserverRawPerformanceEntryBridging<PerformanceEntry> {};
 
 #pragma mark - implementation
 
@@ -57,8 +67,9 @@ class NativePerformanceObserver
       const std::vector<PerformanceEntryType> entryTypes,
       bool isBuffered);
 
-  PerformanceEntryReporter::PopPendingEntriesResult popPendingEntries(
-      jsi::Runtime& rt);
+  // Builds the `GetPendingEntriesResult` object straight from the reporter's
+  // buffers.
+  jsi::Object popPendingEntries(jsi::Runtime& rt);
 
   void setOnPerformanceEntryCallback(
       jsi::Runtime& rt,
@@ -25,8 +25,10 @@ constexpr size_t DEFAULT_MAX_SIZE = 1024;
  * - Even after the entries are consumed, all of the non-overwritten entries
  *   can still be independently retrieved an arbitrary amount of times
  *
- * Note that the space for maxSize elements is reserved on construction. This
- * ensures that pointers to elements remain stable across add() operations.
+ * Note that the space for maxSize elements is reserved on construction, and
+ * once full, the buffer replaces its oldest elements in place. This ensures
+ * that pointers to elements remain stable across add() operations, and that
+ * adding and consuming elements never allocates.
  */
 template <class T>
 class BoundedConsumableBuffer {
@@ -61,21 +63,18 @@ class BoundedConsumableBuffer {
     if (entries_.size() < maxSize_) {
       // Haven't reached max buffer size yet, just add and grow the buffer
       entries_.emplace_back(el);
-      cursorEnd_++;
       numToConsume_++;
       return PushStatus::OK;
-    } else if (numToConsume_ == maxSize_) {
-      // Drop the oldest (yet unconsumed) element in the buffer
-      entries_[position_] = el;
-      cursorEnd_ = (cursorEnd_ + 1) % maxSize_;
-      position_ = (position_ + 1) % maxSize_;
-      cursorStart_ = position_;
+    }
+
+    // Replace the oldest element in place
+    entries_[position_] = el;
+    position_ = (position_ + 1) % maxSize_;
+
+    if (numToConsume_ == maxSize_) {
+      // The oldest element wasn't consumed yet, so it's dropped
       return PushStatus::DROP;
     } else {
-      // Overwrite the oldest (but already consumed) element in the buffer
-      entries_[position_] = el;
-      position_ = (position_ + 1) % entries_.size();
-      cursorEnd_ = position_;
       numToConsume_++;
       return PushStatus::OVERWRITE;
     }
@@ -97,11 +96,15 @@ class BoundedConsumableBuffer {
     return entries_[(position_ + idx) % entries_.size()];
   }
 
+  const T& operator[](size_t idx) const {
+    return entries_[(position_ + idx) % entries_.size()];
+  }
+
   /**
    * Returns reference to the last unconsumed element
    */
   T& back() {
-    return entries_[(cursorEnd_ - 1 + entries_.size()) % entries_.size()];
+    return (*this)[entries_.size() - 1];
   }
 
   size_t size() const {
@@ -115,37 +118,49 @@ class BoundedConsumableBuffer {
   void clear() {
     entries_.clear();
     position_ = 0;
-    cursorStart_ = 0;
-    cursorEnd_ = 0;
     numToConsume_ = 0;
   }
 
   /**
-   * Clears buffer entries by predicate
+   * Clears buffer entries by predicate. Remaining entries are compacted in
+   * place, without reallocating the buffer.
    */
   void clear(std::function<bool(const T&)> predicate) {
-    std::vector<T> entries;
-    int numToConsume = 0;
+    std::rotate(
+        entries_.begin(), entries_.begin() + position_, entries_.end());
+    position_ = 0;
+
+    size_t firstToConsume = entries_.size() - numToConsume_;
+    size_t size = 0;
+    size_t numToConsume = 0;
 
-    entries.reserve(maxSize_);
     for (size_t i = 0; i < entries_.size(); i++) {
-      T& el = entries_[(i + position_) % entries_.size()];
-      if (predicate(el)) {
+      if (predicate(entries_[i])) {
         continue;
       }
 
-      entries.push_back(std::move(el));
-      if (i + numToConsume_ >= entries_.size()) { // el is unconsumed
+      if (i >= firstToConsume) {
         numToConsume++;
       }
+      if (size != i) {
+        entries_[size] = std::move(entries_[i]);
+      }
+      size++;
     }
 
+    entries_.erase(entries_.begin() + size, entries_.end());
     numToConsume_ = numToConsume;
-    cursorEnd_ = entries.size() % maxSize_;
-    cursorStart_ = (cursorEnd_ - numToConsume_ + maxSize_) % maxSize_;
-    position_ = 0;
+  }
 
-    entries.swap(entries_);
+  /**
+   * Calls `visitor` with every buffer entry, whether consumed or not, oldest
+   * first.
+   */
+  template <typename VisitorT>
+  void forEach(VisitorT&& visitor) const {
+    for (size_t i = 0; i < entries_.size(); i++) {
+      visitor((*this)[i]);
+    }
   }
 
   /**
@@ -167,24 +182,30 @@ class BoundedConsumableBuffer {
   }
 
   void getEntries(std::vector<T>& res) const {
-    const size_t oldSize = res.size();
-    res.resize(oldSize + entries_.size());
-    std::copy(
-        entries_.begin() + position_, entries_.end(), res.begin() + oldSize);
-    std::copy(
-        entries_.begin(),
-        entries_.begin() + position_,
-        res.begin() + oldSize + entries_.size() - position_);
+    res.reserve(res.size() + entries_.size());
+    forEach([&](const T& el) { res.push_back(el); });
   }
 
   void getEntries(std::vector<T>& res, std::function<bool(const T&)> predicate)
       const {
-    for (size_t i = 0; i < entries_.size(); i++) {
-      const T& el = entries_[(i + position_) % entries_.size()];
+    forEach([&](const T& el) {
       if (predicate(el)) {
         res.push_back(el);
       }
+    });
+  }
+
+  /**
+   * "Consumes" all the currently unconsumed entries in the buffer, calling
+   * `visitor` with each of them, oldest first. The entries stay in the buffer
+   * (and can still be retrieved via `getEntries`) until overwritten.
+   */
+  template <typename VisitorT>
+  void consumeEach(VisitorT&& visitor) {
+    for (size_t i = entries_.size() - numToConsume_; i < entries_.size(); i++) {
+      visitor((*this)[i]);
     }
+    numToConsume_ = 0;
   }
 
   /**
@@ -200,31 +221,8 @@ class BoundedConsumableBuffer {
   }
 
   void consume(std::vector<T>& res) {
-    if (numToConsume_ == 0) {
-      return;
-    }
-
-    const size_t resStart = res.size();
-    res.resize(res.size() + numToConsume_);
-    if (cursorEnd_ > cursorStart_) {
-      std::copy(
-          entries_.begin() + cursorStart_,
-          entries_.begin() + cursorEnd_,
-          res.begin() + resStart);
-    } else {
-      std::copy(
-          entries_.begin() + cursorStart_,
-          entries_.end(),
-          res.begin() + resStart);
-      std::copy(
-          entries_.begin(),
-          entries_.begin() + cursorEnd_,
-          res.begin() + resStart + static_cast<int>(entries_.size()) -
-              cursorStart_);
-    }
-
-    cursorStart_ = cursorEnd_;
-    numToConsume_ = 0;
+    res.reserve(res.size() + numToConsume_);
+    consumeEach([&](const T& el) { res.push_back(el); });
   }
 
  private:
@@ -232,15 +230,12 @@ class BoundedConsumableBuffer {
 
   const size_t maxSize_;
 
-  // Current starting position in the circular buffer:
+  // Index of the oldest element once the buffer reached its max size (the
+  // next one to be replaced); zero before that:
   size_t position_{0};
 
-  // Current "cursor" - positions of the first and after last unconsumed
-  // element, relative to the starting position:
-  size_t cursorStart_{0};
-  size_t cursorEnd_{0};
-
-  // Number of currently unconsumed elements:
+  // Number of currently unconsumed elements, which are always the newest
+  // ones:
   size_t numToConsume_{0};
 };
 
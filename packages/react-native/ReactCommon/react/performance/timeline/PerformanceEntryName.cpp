@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceEntryName.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Keys are views into the interned strings; an entry is removed by the
+ * deleter of its string, before the string is freed.
+ */
+struct InternTable {
+  std::mutex mutex;
+  std::unordered_map<std::string_view, std::weak_ptr<const std::string>>
+      strings; // Protected by `mutex`.
+};
+
+InternTable& getInternTable() {
+  // Leaked, so names outliving static destruction can still release their
+  // strings.
+  static auto& internTable = *new InternTable();
+  return internTable;
+}
+
+void releaseString(const std::string* string) {
+  auto& internTable = getInternTable();
+  {
+    std::scoped_lock lock(internTable.mutex);
+    auto iterator = internTable.strings.find(*string);
+    // The key may already point to a newer copy, interned after this one
+    // expired but before this deleter got the lock.
+    if (iterator != internTable.strings.end() &&
+        iterator->first.data() == string->data()) {
+      internTable.strings.erase(iterator);
+    }
+  }
+  delete string;
+}
+
+std::shared_ptr<const std::string> intern(std::string_view name) {
+  auto& internTable = getInternTable();
+  std::scoped_lock lock(internTable.mutex);
+
+  auto iterator = internTable.strings.find(name);
+  if (iterator != internTable.strings.end()) {
+    if (auto string = iterator->second.lock()) {
+      return string;
+    }
+    // Expired; its deleter is waiting for the lock.
+    internTable.strings.erase(iterator);
+  }
+
+  auto string = std::shared_ptr<const std::string>(
+      new std::string(name), releaseString);
+  internTable.strings.emplace(*string, string);
+  return string;
+}
+
+} // namespace
+
+PerformanceEntryName::PerformanceEntryName() {
+  static const auto emptyName = intern({});
+  string_ = emptyName;
+}
+
+PerformanceEntryName::PerformanceEntryName(std::string_view name)
+    : string_(intern(name)) {}
+
+} // namespace facebook::react
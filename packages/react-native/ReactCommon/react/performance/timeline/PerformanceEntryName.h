@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace facebook::react {
+
+/*
+ * Interned name of a `PerformanceEntry`.
+ * All live names with the same value share one copy of the string, so
+ * buffering an entry doesn't copy its name, and names are compared and
+ * hashed by identity. The string is released with the last name referencing
+ * it.
+ */
+class PerformanceEntryName final {
+ public:
+  PerformanceEntryName();
+  PerformanceEntryName(std::string_view name);
+  PerformanceEntryName(const std::string& name)
+      : PerformanceEntryName(std::string_view{name}) {}
+  PerformanceEntryName(const char* name)
+      : PerformanceEntryName(std::string_view{name}) {}
+
+  const std::string& str() const {
+    return *string_;
+  }
+
+  const char* c_str() const {
+    return string_->c_str();
+  }
+
+  operator const std::string&() const {
+    return *string_;
+  }
+
+  bool operator==(const PerformanceEntryName& rhs) const {
+    return string_ == rhs.string_;
+  }
+
+  bool operator!=(const PerformanceEntryName& rhs) const {
+    return string_ != rhs.string_;
+  }
+
+ private:
+  friend struct std::hash<PerformanceEntryName>;
+
+  std::shared_ptr<const std::string> string_;
+};
+
+/*
+ * Hash and equality of names by value rather than identity, so containers
+ * using them can be searched with a `std::string_view` without interning it.
+ */
+struct PerformanceEntryNameValueHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view name) const {
+    return std::hash<std::string_view>{}(name);
+  }
+
+  size_t operator()(const PerformanceEntryName& name) const {
+    return std::hash<std::string_view>{}(name.str());
+  }
+};
+
+struct PerformanceEntryNameValueEqual {
+  using is_transparent = void;
+
+  bool operator()(
+      const PerformanceEntryName& lhs,
+      const PerformanceEntryName& rhs) const {
+    return lhs == rhs;
+  }
+
+  bool operator()(const PerformanceEntryName& lhs, std::string_view rhs)
+      const {
+    return lhs.str() == rhs;
+  }
+
+  bool operator()(std::string_view lhs, const PerformanceEntryName& rhs)
+      const {
+    return lhs == rhs.str();
+  }
+};
+
+inline std::ostream& operator<<(
+    std::ostream& os,
+    const PerformanceEntryName& name) {
+  return os << name.str();
+}
+
+} // namespace facebook::react
+
+namespace std {
+
+template <>
+struct hash<facebook::react::PerformanceEntryName> {
+  size_t operator()(const facebook::react::PerformanceEntryName& name) const {
+    return std::hash<const std::string*>{}(name.string_.get());
+  }
+};
+
+} // namespace std
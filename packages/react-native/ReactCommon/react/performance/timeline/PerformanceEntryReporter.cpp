@@ -9,6 +9,8 @@
 
 #include <cxxreact/JSExecutor.h>
 
+#include <algorithm>
+
 namespace facebook::react {
 
 std::shared_ptr<PerformanceEntryReporter>&
@@ -65,25 +67,34 @@ void PerformanceEntryReporter::stopReporting() {
 PerformanceEntryReporter::PopPendingEntriesResult
 PerformanceEntryReporter::popPendingEntries() {
   std::lock_guard lock(entriesMutex_);
-  PopPendingEntriesResult res = {
-      .entries = std::vector<PerformanceEntry>(),
-      .droppedEntriesCount = droppedEntriesCount_};
+  pendingEntries_.clear();
   for (auto& buffer : buffers_) {
-    buffer.entries.consume(res.entries);
+    buffer.entries.consumeEach([&](const PerformanceEntry& entry) {
+      pendingEntries_.push_back(&entry);
+    });
   }
 
-  // Sort by starting time (or ending time, if starting times are equal)
+  // Sort by starting time (or ending time, if starting times are equal).
+  // Pointers are sorted so that each entry is only copied once.
   std::stable_sort(
-      res.entries.begin(),
-      res.entries.end(),
-      [](const PerformanceEntry& lhs, const PerformanceEntry& rhs) {
-        if (lhs.startTime != rhs.startTime) {
-          return lhs.startTime < rhs.startTime;
+      pendingEntries_.begin(),
+      pendingEntries_.end(),
+      [](const PerformanceEntry* lhs, const PerformanceEntry* rhs) {
+        if (lhs->startTime != rhs->startTime) {
+          return lhs->startTime < rhs->startTime;
         } else {
-          return lhs.duration < rhs.duration;
+          return lhs->duration < rhs->duration;
         }
       });
 
+  PopPendingEntriesResult res = {
+      .entries = std::vector<PerformanceEntry>(),
+      .droppedEntriesCount = droppedEntriesCount_};
+  res.entries.reserve(pendingEntries_.size());
+  for (const auto* entry : pendingEntries_) {
+    res.entries.push_back(*entry);
+  }
+
   droppedEntriesCount_ = 0;
   return res;
 }
@@ -112,8 +123,8 @@ void PerformanceEntryReporter::logEntry(const PerformanceEntry& entry) {
     auto overwriteCandidate = buffer.entries.getNextOverwriteCandidate();
     if (overwriteCandidate != nullptr) {
       std::lock_guard lock2(nameLookupMutex_);
-      auto it = buffer.nameLookup.find(overwriteCandidate);
-      if (it != buffer.nameLookup.end() && *it == overwriteCandidate) {
+      auto it = buffer.nameLookup.find(overwriteCandidate->name);
+      if (it != buffer.nameLookup.end() && it->second == overwriteCandidate) {
         buffer.nameLookup.erase(it);
       }
     }
@@ -130,12 +141,8 @@ void PerformanceEntryReporter::logEntry(const PerformanceEntry& entry) {
 
   if (buffer.hasNameLookup) {
     std::lock_guard lock2(nameLookupMutex_);
-    auto currentEntry = &buffer.entries.back();
-    auto it = buffer.nameLookup.find(currentEntry);
-    if (it != buffer.nameLookup.end()) {
-      buffer.nameLookup.erase(it);
-    }
-    buffer.nameLookup.insert(currentEntry);
+    const auto& currentEntry = buffer.entries.back();
+    buffer.nameLookup.insert_or_assign(currentEntry.name, &currentEntry);
   }
 
   if (buffer.entries.getNumToConsume() == 1) {
@@ -159,7 +166,7 @@ void PerformanceEntryReporter::clearEntries(
     std::string_view entryName) {
   if (!entryType) {
     // Clear all entry types
-    for (int i = 1; i < NUM_PERFORMANCE_ENTRY_TYPES; i++) {
+    for (int i = 1; i <= NUM_PERFORMANCE_ENTRY_TYPES; i++) {
       clearEntries(static_cast<PerformanceEntryType>(i), entryName);
     }
   } else {
@@ -172,18 +179,17 @@ void PerformanceEntryReporter::clearEntries(
 
       std::lock_guard lock(entriesMutex_);
       buffer.entries.clear([entryName](const PerformanceEntry& entry) {
-        return entry.name == entryName;
+        return entry.name.str() == entryName;
       });
 
       if (buffer.hasNameLookup) {
         std::lock_guard lock2(nameLookupMutex_);
-        // BoundedConsumableBuffer::clear() invalidates existing references; we
+        // BoundedConsumableBuffer::clear() moves the remaining entries; we
         // need to rebuild the lookup table. If there are multiple entries with
-        // the same name, make sure the last one gets inserted.
-        for (int i = static_cast<int>(buffer.entries.size()) - 1; i >= 0; i--) {
-          const auto& entry = buffer.entries[i];
-          buffer.nameLookup.insert(&entry);
-        }
+        // the same name, make sure the last one wins.
+        buffer.entries.forEach([&](const PerformanceEntry& entry) {
+          buffer.nameLookup.insert_or_assign(entry.name, &entry);
+        });
       }
     } else {
       {
@@ -208,7 +214,7 @@ void PerformanceEntryReporter::getEntries(
     entries.getEntries(res);
   } else {
     entries.getEntries(res, [entryName](const PerformanceEntry& entry) {
-      return entry.name == entryName;
+      return entry.name.str() == entryName;
     });
   }
 }
@@ -219,7 +225,7 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries(
   std::vector<PerformanceEntry> res;
   if (!entryType) {
     // Collect all entry types
-    for (int i = 1; i < NUM_PERFORMANCE_ENTRY_TYPES; i++) {
+    for (int i = 1; i <= NUM_PERFORMANCE_ENTRY_TYPES; i++) {
       getEntries(static_cast<PerformanceEntryType>(i), entryName, res);
     }
   } else {
@@ -249,7 +255,7 @@ void PerformanceEntryReporter::measure(
       duration ? *duration : endTimeVal - startTimeVal;
 
   logEntry(
-      {.name = std::string(name),
+      {.name = name,
        .entryType = PerformanceEntryType::MEASURE,
        .startTime = startTimeVal,
        .duration = durationVal});
@@ -257,14 +263,11 @@ void PerformanceEntryReporter::measure(
 
 DOMHighResTimeStamp PerformanceEntryReporter::getMarkTime(
     const std::string& markName) const {
-  PerformanceEntry mark{
-      .name = markName, .entryType = PerformanceEntryType::MARK};
-
   std::lock_guard lock(nameLookupMutex_);
   const auto& marksBuffer = getBuffer(PerformanceEntryType::MARK);
-  auto it = marksBuffer.nameLookup.find(&mark);
+  auto it = marksBuffer.nameLookup.find(std::string_view{markName});
   if (it != marksBuffer.nameLookup.end()) {
-    return (*it)->startTime;
+    return it->second->startTime;
   } else {
     return 0.0;
   }
@@ -290,13 +293,25 @@ void PerformanceEntryReporter::logEventEntry(
 void PerformanceEntryReporter::logLongTaskEntry(
     DOMHighResTimeStamp startTime,
     DOMHighResTimeStamp duration) {
+  static const auto longTaskName = PerformanceEntryName{"self"};
   logEntry(
-      {.name = std::string{"self"},
+      {.name = longTaskName,
        .entryType = PerformanceEntryType::LONGTASK,
        .startTime = startTime,
        .duration = duration});
 }
 
+void PerformanceEntryReporter::logStallEntry(
+    PerformanceEntryName name,
+    DOMHighResTimeStamp startTime,
+    DOMHighResTimeStamp duration) {
+  logEntry(
+      {.name = std::move(name),
+       .entryType = PerformanceEntryType::STALL,
+       .startTime = startTime,
+       .duration = duration});
+}
+
 void PerformanceEntryReporter::scheduleFlushBuffer() {
   if (callback_) {
     callback_();
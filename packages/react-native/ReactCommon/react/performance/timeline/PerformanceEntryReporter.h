@@ -9,6 +9,7 @@
 
 #include <react/timing/primitives.h>
 #include "BoundedConsumableBuffer.h"
+#include "PerformanceEntryName.h"
 
 #include <array>
 #include <functional>
@@ -17,7 +18,7 @@
 #include <optional>
 #include <string_view>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 namespace facebook::react {
 
@@ -29,11 +30,14 @@ enum class PerformanceEntryType {
   MEASURE = 2,
   EVENT = 3,
   LONGTASK = 4,
-  _NEXT = 5,
+  // React Native specific: the JavaScript thread was found blocked by a task
+  // that was still running (see `RuntimeSchedulerStallDetector`).
+  STALL = 5,
+  _NEXT = 6,
 };
 
 struct PerformanceEntry {
-  std::string name;
+  PerformanceEntryName name;
   PerformanceEntryType entryType;
   DOMHighResTimeStamp startTime;
   DOMHighResTimeStamp duration = 0;
@@ -42,25 +46,26 @@ struct PerformanceEntry {
   std::optional<DOMHighResTimeStamp> processingStart;
   std::optional<DOMHighResTimeStamp> processingEnd;
   std::optional<PerformanceEntryInteractionId> interactionId;
-};
 
-struct PerformanceEntryHash {
-  size_t operator()(const PerformanceEntry* entry) const {
-    return std::hash<std::string>()(entry->name);
-  }
-};
-
-struct PerformanceEntryEqual {
-  bool operator()(const PerformanceEntry* lhs, const PerformanceEntry* rhs)
-      const {
-    return lhs->name == rhs->name;
-  }
+  // For "event" entries reported after the updates they caused were mounted
+  // (native only). Time spent by those updates in each phase of the
+  // rendering pipeline. `commitDuration` includes `layoutDuration`, and
+  // `mountDuration` spans from the end of the diff to the mount being reported
+  // by the host platform. Queueing and JS processing are given by
+  // `processingStart` and `processingEnd`.
+  std::optional<DOMHighResTimeStamp> commitDuration;
+  std::optional<DOMHighResTimeStamp> layoutDuration;
+  std::optional<DOMHighResTimeStamp> diffDuration;
+  std::optional<DOMHighResTimeStamp> mountDuration;
 };
 
-using PerformanceEntryRegistryType = std::unordered_set<
+// Latest entry with a given name, for entry types with name lookup. Looked up
+// by value, so names given by JS don't have to be interned.
+using PerformanceEntryRegistryType = std::unordered_map<
+    PerformanceEntryName,
     const PerformanceEntry*,
-    PerformanceEntryHash,
-    PerformanceEntryEqual>;
+    PerformanceEntryNameValueHash,
+    PerformanceEntryNameValueEqual>;
 
 // Default duration threshold for reporting performance entries (0 means "report
 // all")
@@ -162,7 +167,13 @@ class PerformanceEntryReporter {
 
   void logLongTaskEntry(double startTime, double duration);
 
-  const std::unordered_map<std::string, uint32_t>& getEventCounts() const {
+  void logStallEntry(
+      PerformanceEntryName name,
+      double startTime,
+      double duration);
+
+  const std::unordered_map<PerformanceEntryName, uint32_t>& getEventCounts()
+      const {
     return eventCounts_;
   }
 
@@ -177,7 +188,10 @@ class PerformanceEntryReporter {
 
   mutable std::mutex entriesMutex_;
   std::array<PerformanceEntryBuffer, NUM_PERFORMANCE_ENTRY_TYPES> buffers_;
-  std::unordered_map<std::string, uint32_t> eventCounts_;
+  std::unordered_map<PerformanceEntryName, uint32_t> eventCounts_;
+
+  // Reused by `popPendingEntries`. Protected by `entriesMutex_`.
+  std::vector<const PerformanceEntry*> pendingEntries_;
 
   uint32_t droppedEntriesCount_{0};
 
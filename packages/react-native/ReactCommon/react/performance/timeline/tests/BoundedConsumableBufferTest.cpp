@@ -216,4 +216,27 @@ TEST(BoundedConsumableBuffer, CanGetByPredicate) {
   }));
 }
 
+TEST(BoundedConsumableBuffer, ConsumesInPlaceWithStableAddresses) {
+  BoundedConsumableBuffer<int> buffer(3);
+
+  buffer.add(1);
+  buffer.add(2);
+  buffer.add(3);
+  const int* first = &buffer[0];
+
+  std::vector<int> consumed;
+  buffer.consumeEach([&](const int& el) { consumed.push_back(el); });
+  ASSERT_EQ(std::vector<int>({1, 2, 3}), consumed);
+  ASSERT_EQ(0, buffer.getNumToConsume());
+
+  // Once full, the oldest element is replaced in place.
+  ASSERT_EQ(OVERWRITE, buffer.add(4));
+  ASSERT_EQ(first, &buffer.back());
+  ASSERT_EQ(4, buffer.back());
+
+  consumed.clear();
+  buffer.consumeEach([&](const int& el) { consumed.push_back(el); });
+  ASSERT_EQ(std::vector<int>({4}), consumed);
+}
+
 } // namespace facebook::react
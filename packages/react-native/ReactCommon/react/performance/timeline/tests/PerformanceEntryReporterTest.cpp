@@ -31,6 +31,8 @@ namespace facebook::react {
       "MARK",
       "MEASURE",
       "EVENT",
+      "LONGTASK",
+      "STALL",
   };
   return os << "{ name: " << entry.name
             << ", type: " << entryTypeNames[static_cast<int>(entry.entryType)]
@@ -366,3 +368,85 @@ TEST(PerformanceEntryReporter, PerformanceEntryReporterTestClearEntries) {
 
   ASSERT_EQ(0, e4.size());
 }
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestConsumeEntries) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+
+  reporter->stopReporting();
+  reporter->clearEntries();
+
+  reporter->startReporting(PerformanceEntryType::MARK);
+  reporter->startReporting(PerformanceEntryType::MEASURE);
+
+  reporter->mark("mark0", 2.0);
+  reporter->measure("measure0", 1.0, 3.0);
+  reporter->mark("mark1", 0.0);
+
+  auto pendingEntries = reporter->popPendingEntries();
+  ASSERT_EQ(0, pendingEntries.droppedEntriesCount);
+  auto names = std::vector<std::string>{};
+  for (const auto& entry : pendingEntries.entries) {
+    names.push_back(entry.name);
+  }
+
+  ASSERT_EQ(std::vector<std::string>({"mark1", "measure0", "mark0"}), names);
+  ASSERT_EQ(0, reporter->popPendingEntries().entries.size());
+  ASSERT_EQ(3, reporter->getEntries().size());
+}
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestInternsNames) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+
+  reporter->stopReporting();
+  reporter->clearEntries();
+
+  reporter->startReporting(PerformanceEntryType::MARK);
+
+  reporter->mark(std::string("mark") + "0", 0.0);
+  reporter->mark(std::string("mark") + "0", 1.0);
+
+  auto entries = reporter->popPendingEntries().entries;
+
+  ASSERT_EQ(2, entries.size());
+  ASSERT_EQ(entries[0].name, entries[1].name);
+  ASSERT_EQ(
+      &static_cast<const std::string&>(entries[0].name),
+      &static_cast<const std::string&>(entries[1].name));
+  ASSERT_EQ(PerformanceEntryName{"mark0"}, entries[0].name);
+  ASSERT_NE(PerformanceEntryName{"mark1"}, entries[0].name);
+
+  // The latest mark with a name is used by measures.
+  reporter->startReporting(PerformanceEntryType::MEASURE);
+  reporter->measure("measure0", 0.0, 0.0, std::nullopt, "mark0", "mark0");
+
+  auto measures = reporter->getEntries(PerformanceEntryType::MEASURE);
+  ASSERT_EQ(1, measures.size());
+  ASSERT_EQ(1.0, measures[0].startTime);
+}
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestReportStalls) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+
+  reporter->stopReporting();
+  reporter->clearEntries();
+
+  reporter->startReporting(PerformanceEntryType::MEASURE);
+  reporter->startReporting(PerformanceEntryType::STALL);
+
+  reporter->measure("measure0", 0.0, 10.0);
+  reporter->logStallEntry(
+      "Stall in task, normal priority, JS callback", 0.0, 60.0);
+
+  // Stalls have their own entry type, so they aren't mixed with measures.
+  auto stalls = reporter->getEntries(PerformanceEntryType::STALL);
+  ASSERT_EQ(1, stalls.size());
+  ASSERT_EQ(
+      PerformanceEntryName{"Stall in task, normal priority, JS callback"},
+      stalls[0].name);
+  ASSERT_EQ(60.0, stalls[0].duration);
+  ASSERT_EQ(1, reporter->getEntries(PerformanceEntryType::MEASURE).size());
+  ASSERT_EQ(2, reporter->getEntries().size());
+
+  reporter->clearEntries();
+  ASSERT_EQ(0, reporter->getEntries(PerformanceEntryType::STALL).size());
+}
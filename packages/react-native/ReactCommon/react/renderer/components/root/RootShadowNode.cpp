@@ -43,7 +43,7 @@ RootShadowNode::Unshared RootShadowNode::clone(
     const LayoutContext& layoutContext) const {
   auto props = std::make_shared<const RootProps>(
       propsParserContext, getConcreteProps(), layoutConstraints, layoutContext);
-  auto newRootShadowNode = std::make_shared<RootShadowNode>(
+  auto newRootShadowNode = makeSharedShadowNode<RootShadowNode>(
       *this,
       ShadowNodeFragment{
           /* .props = */ props,
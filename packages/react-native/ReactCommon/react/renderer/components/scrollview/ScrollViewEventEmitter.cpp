@@ -7,24 +7,30 @@
 
 #include "ScrollViewEventEmitter.h"
 
+#include <react/renderer/core/EventPayloadPool.h>
+
 namespace facebook::react {
 
 void ScrollViewEventEmitter::onScroll(const ScrollEvent& scrollEvent) const {
-  dispatchUniqueEvent("scroll", std::make_shared<ScrollEvent>(scrollEvent));
+  // Constructed once; scroll events are dispatched every frame.
+  static const auto eventType = EventType{"scroll"};
+  dispatchUniqueEvent(
+      eventType, makeSharedEventPayload<ScrollEvent>(scrollEvent));
 }
 
 void ScrollViewEventEmitter::experimental_onDiscreteScroll(
     const ScrollEvent& scrollEvent) const {
+  static const auto eventType = EventType{"scroll"};
   dispatchEvent(
-      "scroll",
-      std::make_shared<ScrollEvent>(scrollEvent),
+      eventType,
+      makeSharedEventPayload<ScrollEvent>(scrollEvent),
       RawEvent::Category::Discrete);
 }
 
 void ScrollViewEventEmitter::onScrollToTop(
     const ScrollEvent& scrollEvent) const {
   dispatchUniqueEvent(
-      "scrollToTop", std::make_shared<ScrollEvent>(scrollEvent));
+      "scrollToTop", makeSharedEventPayload<ScrollEvent>(scrollEvent));
 }
 
 void ScrollViewEventEmitter::onScrollBeginDrag(
@@ -48,9 +54,9 @@ void ScrollViewEventEmitter::onMomentumScrollEnd(
 }
 
 void ScrollViewEventEmitter::dispatchScrollViewEvent(
-    std::string name,
+    EventType type,
     const ScrollEvent& scrollEvent) const {
-  dispatchEvent(std::move(name), std::make_shared<ScrollEvent>(scrollEvent));
+  dispatchEvent(type, makeSharedEventPayload<ScrollEvent>(scrollEvent));
 }
 
 } // namespace facebook::react
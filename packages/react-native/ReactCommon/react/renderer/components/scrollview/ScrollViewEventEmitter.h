@@ -31,7 +31,7 @@ class ScrollViewEventEmitter : public ViewEventEmitter {
   void onScrollToTop(const ScrollEvent& scrollEvent) const;
 
  private:
-  void dispatchScrollViewEvent(std::string name, const ScrollEvent& scrollEvent)
+  void dispatchScrollViewEvent(EventType type, const ScrollEvent& scrollEvent)
       const;
 };
 
@@ -27,6 +27,19 @@ class ParagraphComponentDescriptor final
     textLayoutManager_ = std::make_shared<TextLayoutManager>(contextContainer_);
   }
 
+  size_t estimateStateSize(const State& state) const override {
+    auto size = ConcreteComponentDescriptor::estimateStateSize(state);
+
+    // Paragraphs keep a copy of their attributed string in their state.
+    const auto& attributedString =
+        static_cast<const ConcreteState&>(state).getData().attributedString;
+    for (const auto& fragment : attributedString.getFragments()) {
+      size += sizeof(fragment) + fragment.string.capacity();
+    }
+
+    return size;
+  }
+
  protected:
   void adopt(ShadowNode& shadowNode) const override {
     ConcreteComponentDescriptor::adopt(shadowNode);
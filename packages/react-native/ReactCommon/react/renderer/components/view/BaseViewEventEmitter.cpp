@@ -9,6 +9,14 @@
 
 namespace facebook::react {
 
+// Payloads are immutable, so all events without data can share one.
+static const SharedEventPayload& emptyPayload() {
+  static const SharedEventPayload payload =
+      std::make_shared<ValueFactoryEventPayload>(
+          EventEmitter::defaultPayloadFactory());
+  return payload;
+}
+
 #pragma mark - Accessibility
 
 void BaseViewEventEmitter::onAccessibilityAction(
@@ -21,33 +29,36 @@ void BaseViewEventEmitter::onAccessibilityAction(
 }
 
 void BaseViewEventEmitter::onAccessibilityTap() const {
-  dispatchEvent("accessibilityTap");
+  dispatchEvent("accessibilityTap", emptyPayload());
 }
 
 void BaseViewEventEmitter::onAccessibilityMagicTap() const {
-  dispatchEvent("magicTap");
+  dispatchEvent("magicTap", emptyPayload());
 }
 
 void BaseViewEventEmitter::onAccessibilityEscape() const {
-  dispatchEvent("accessibilityEscape");
+  dispatchEvent("accessibilityEscape", emptyPayload());
 }
 
 #pragma mark - Focus
 void BaseViewEventEmitter::onFocus() const {
-  dispatchEvent("focus");
+  // Focus moves with every remote/keyboard navigation step on TV.
+  static const auto eventType = EventType{"focus"};
+  dispatchEvent(eventType, emptyPayload());
 }
 
 void BaseViewEventEmitter::onBlur() const {
-  dispatchEvent("blur");
+  static const auto eventType = EventType{"blur"};
+  dispatchEvent(eventType, emptyPayload());
 }
 
 #pragma mark - Press
 void BaseViewEventEmitter::onPressIn() const {
-  dispatchEvent("pressIn");
+  dispatchEvent("pressIn", emptyPayload());
 }
 
 void BaseViewEventEmitter::onPressOut() const {
-  dispatchEvent("pressOut");
+  dispatchEvent("pressOut", emptyPayload());
 }
 
 #pragma mark - Layout
@@ -97,7 +108,8 @@ void BaseViewEventEmitter::onLayout(const LayoutMetrics& layoutMetrics) const {
     layoutEventState->isDispatching = true;
   }
 
-  dispatchEvent("layout", [layoutEventState](jsi::Runtime& runtime) {
+  static const auto eventType = EventType{"layout"};
+  dispatchEvent(eventType, [layoutEventState](jsi::Runtime& runtime) {
     auto frame = Rect{};
 
     {
@@ -7,6 +7,8 @@
 
 #include "TouchEventEmitter.h"
 
+#include <react/renderer/core/EventPayloadPool.h>
+
 namespace facebook::react {
 
 #pragma mark - Touches
@@ -43,11 +45,11 @@ static jsi::Value touchEventPayload(
 }
 
 void TouchEventEmitter::dispatchTouchEvent(
-    std::string type,
+    EventType type,
     const TouchEvent& event,
     RawEvent::Category category) const {
   dispatchEvent(
-      std::move(type),
+      type,
       [event](jsi::Runtime& runtime) {
         return touchEventPayload(runtime, event);
       },
@@ -55,11 +57,10 @@ void TouchEventEmitter::dispatchTouchEvent(
 }
 
 void TouchEventEmitter::dispatchPointerEvent(
-    std::string type,
+    EventType type,
     const PointerEvent& event,
     RawEvent::Category category) const {
-  dispatchEvent(
-      std::move(type), std::make_shared<PointerEvent>(event), category);
+  dispatchEvent(type, makeSharedEventPayload<PointerEvent>(event), category);
 }
 
 void TouchEventEmitter::onTouchStart(const TouchEvent& event) const {
@@ -67,7 +68,8 @@ void TouchEventEmitter::onTouchStart(const TouchEvent& event) const {
 }
 
 void TouchEventEmitter::onTouchMove(const TouchEvent& event) const {
-  dispatchUniqueEvent("touchMove", [event](jsi::Runtime& runtime) {
+  static const auto eventType = EventType{"touchMove"};
+  dispatchUniqueEvent(eventType, [event](jsi::Runtime& runtime) {
     return touchEventPayload(runtime, event);
   });
 }
@@ -95,7 +97,8 @@ void TouchEventEmitter::onPointerDown(const PointerEvent& event) const {
 }
 
 void TouchEventEmitter::onPointerMove(const PointerEvent& event) const {
-  dispatchUniqueEvent("pointerMove", std::make_shared<PointerEvent>(event));
+  static const auto eventType = EventType{"pointerMove"};
+  dispatchUniqueEvent(eventType, makeSharedEventPayload<PointerEvent>(event));
 }
 
 void TouchEventEmitter::onPointerUp(const PointerEvent& event) const {
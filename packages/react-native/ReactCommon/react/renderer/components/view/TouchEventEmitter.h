@@ -43,11 +43,11 @@ class TouchEventEmitter : public EventEmitter {
 
  private:
   void dispatchTouchEvent(
-      std::string type,
+      EventType type,
       const TouchEvent& event,
       RawEvent::Category category) const;
   void dispatchPointerEvent(
-      std::string type,
+      EventType type,
       const PointerEvent& event,
       RawEvent::Category category) const;
 };
@@ -21,4 +21,17 @@ ComponentDescriptor::getContextContainer() const {
   return contextContainer_;
 }
 
+size_t ComponentDescriptor::estimateShadowNodeSize(
+    const ShadowNode& /*shadowNode*/) const {
+  return sizeof(ShadowNode);
+}
+
+size_t ComponentDescriptor::estimatePropsSize(const Props& /*props*/) const {
+  return sizeof(Props);
+}
+
+size_t ComponentDescriptor::estimateStateSize(const State& /*state*/) const {
+  return sizeof(State);
+}
+
 } // namespace facebook::react
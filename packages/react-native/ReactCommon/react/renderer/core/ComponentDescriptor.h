@@ -128,6 +128,19 @@ class ComponentDescriptor {
   virtual ShadowNodeFamily::Shared createFamily(
       const ShadowNodeFamilyFragment& fragment) const = 0;
 
+  /*
+   * Estimate the number of bytes used by a `ShadowNode`, `Props` or `State`
+   * object of this component, for memory accounting.
+   * Nodes share their children, props and state with other nodes (including
+   * nodes from other revisions), so those aren't included in the size of the
+   * node.
+   * Override these methods to account for memory allocated by the objects
+   * themselves (e.g. strings).
+   */
+  virtual size_t estimateShadowNodeSize(const ShadowNode& shadowNode) const;
+  virtual size_t estimatePropsSize(const Props& props) const;
+  virtual size_t estimateStateSize(const State& state) const;
+
  protected:
   friend ShadowNode;
 
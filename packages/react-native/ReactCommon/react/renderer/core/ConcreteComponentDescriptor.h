@@ -16,6 +16,7 @@
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeAllocation.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/core/State.h>
 #include <react/renderer/graphics/Float.h>
@@ -67,7 +68,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       const ShadowNodeFragment& fragment,
       const ShadowNodeFamily::Shared& family) const override {
     auto shadowNode =
-        std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+        makeSharedShadowNode<ShadowNodeT>(fragment, family, getTraits());
 
     adopt(*shadowNode);
 
@@ -77,7 +78,8 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   ShadowNode::Unshared cloneShadowNode(
       const ShadowNode& sourceShadowNode,
       const ShadowNodeFragment& fragment) const override {
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode =
+        makeSharedShadowNode<ShadowNodeT>(sourceShadowNode, fragment);
     sourceShadowNode.transferRuntimeShadowNodeReference(shadowNode, fragment);
 
     adopt(*shadowNode);
@@ -176,6 +178,19 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
         fragment, std::move(eventEmitter), eventDispatcher_, *this);
   }
 
+  size_t estimateShadowNodeSize(
+      const ShadowNode& /*shadowNode*/) const override {
+    return sizeof(ShadowNodeT);
+  }
+
+  size_t estimatePropsSize(const Props& /*props*/) const override {
+    return sizeof(ConcreteProps);
+  }
+
+  size_t estimateStateSize(const State& /*state*/) const override {
+    return sizeof(ConcreteState) + sizeof(ConcreteStateData);
+  }
+
  protected:
   virtual void adopt(ShadowNode& shadowNode) const override {
     // Default implementation does nothing.
@@ -105,6 +105,13 @@ class ConcreteState : public State {
     updateState(Data(getData(), std::move(data)));
   }
 
+  StateData::Shared createData(
+      const StateData::Shared& previousData,
+      const folly::dynamic& data) const override {
+    return std::make_shared<const Data>(
+        *std::static_pointer_cast<const Data>(previousData), data);
+  }
+
   MapBuffer getMapBuffer() const override {
     if constexpr (usesMapBufferForStateData) {
       return getData().getMapBuffer();
@@ -7,35 +7,21 @@
 
 #include "EventEmitter.h"
 
+#include <array>
+#include <cstdint>
+
 #include <cxxreact/SystraceSection.h>
 #include <folly/dynamic.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
 
+#include "EventPayloadPool.h"
 #include "RawEvent.h"
 
 namespace facebook::react {
 
-static bool hasPrefix(const std::string& str, const std::string& prefix) {
-  return str.compare(0, prefix.length(), prefix) == 0;
-}
-
-// TODO(T29874519): Get rid of "top" prefix once and for all.
-/*
- * Replaces "on" with "top" if present. Or capitalizes the first letter and adds
- * "top" prefix. E.g. "eventName" becomes "topEventName", "onEventName" also
- * becomes "topEventName".
- */
 /* static */ std::string EventEmitter::normalizeEventType(std::string type) {
-  auto prefixedType = std::move(type);
-  if (facebook::react::hasPrefix(prefixedType, "top")) {
-    return prefixedType;
-  }
-  if (facebook::react::hasPrefix(prefixedType, "on")) {
-    return "top" + prefixedType.substr(2);
-  }
-  prefixedType[0] = static_cast<char>(toupper(prefixedType[0]));
-  return "top" + prefixedType;
+  return EventType{type}.normalized().getName();
 }
 
 std::mutex& EventEmitter::DispatchMutex() {
@@ -43,6 +29,15 @@ std::mutex& EventEmitter::DispatchMutex() {
   return mutex;
 }
 
+std::mutex& EventEmitter::eventTargetMutex() const {
+  constexpr size_t kMutexCount = 64;
+  static std::array<std::mutex, kMutexCount> mutexes;
+  // Emitters are heap-allocated, so the low bits of the address carry no
+  // information.
+  auto address = reinterpret_cast<uintptr_t>(this);
+  return mutexes[(address >> 4) % kMutexCount];
+}
+
 ValueFactory EventEmitter::defaultPayloadFactory() {
   static auto payloadFactory =
       ValueFactory{[](jsi::Runtime& runtime) { return jsi::Object(runtime); }};
@@ -56,11 +51,11 @@ EventEmitter::EventEmitter(
       eventDispatcher_(std::move(eventDispatcher)) {}
 
 void EventEmitter::dispatchEvent(
-    std::string type,
+    EventType type,
     const folly::dynamic& payload,
     RawEvent::Category category) const {
   dispatchEvent(
-      std::move(type),
+      type,
       [payload](jsi::Runtime& runtime) {
         return valueFromDynamic(runtime, payload);
       },
@@ -68,28 +63,28 @@ void EventEmitter::dispatchEvent(
 }
 
 void EventEmitter::dispatchUniqueEvent(
-    std::string type,
+    EventType type,
     const folly::dynamic& payload) const {
-  dispatchUniqueEvent(std::move(type), [payload](jsi::Runtime& runtime) {
+  dispatchUniqueEvent(type, [payload](jsi::Runtime& runtime) {
     return valueFromDynamic(runtime, payload);
   });
 }
 
 void EventEmitter::dispatchEvent(
-    std::string type,
+    EventType type,
     const ValueFactory& payloadFactory,
     RawEvent::Category category) const {
   dispatchEvent(
-      std::move(type),
-      std::make_shared<ValueFactoryEventPayload>(payloadFactory),
+      type,
+      makeSharedEventPayload<ValueFactoryEventPayload>(payloadFactory),
       category);
 }
 
 void EventEmitter::dispatchEvent(
-    std::string type,
+    EventType type,
     SharedEventPayload payload,
     RawEvent::Category category) const {
-  SystraceSection s("EventEmitter::dispatchEvent", "type", type);
+  SystraceSection s("EventEmitter::dispatchEvent", "type", type.getName());
 
   auto eventDispatcher = eventDispatcher_.lock();
   if (!eventDispatcher) {
@@ -97,22 +92,22 @@ void EventEmitter::dispatchEvent(
   }
 
   eventDispatcher->dispatchEvent(RawEvent(
-      normalizeEventType(std::move(type)),
+      type.normalized(),
       std::move(payload),
-      eventTarget_,
+      getEventTarget(),
       category));
 }
 
 void EventEmitter::dispatchUniqueEvent(
-    std::string type,
+    EventType type,
     const ValueFactory& payloadFactory) const {
   dispatchUniqueEvent(
-      std::move(type),
-      std::make_shared<ValueFactoryEventPayload>(payloadFactory));
+      type,
+      makeSharedEventPayload<ValueFactoryEventPayload>(payloadFactory));
 }
 
 void EventEmitter::dispatchUniqueEvent(
-    std::string type,
+    EventType type,
     SharedEventPayload payload) const {
   SystraceSection s("EventEmitter::dispatchUniqueEvent");
 
@@ -122,15 +117,17 @@ void EventEmitter::dispatchUniqueEvent(
   }
 
   eventDispatcher->dispatchUniqueEvent(RawEvent(
-      normalizeEventType(std::move(type)),
+      type.normalized(),
       std::move(payload),
-      eventTarget_,
+      getEventTarget(),
       RawEvent::Category::Continuous));
 }
 
 void EventEmitter::setEnabled(bool enabled) const {
   enableCounter_ += enabled ? 1 : -1;
 
+  // `eventTarget_` is only ever written below, on this (serialized) path, so
+  // reading it here doesn't need the lock.
   bool shouldBeEnabled = enableCounter_ > 0;
   if (isEnabled_ != shouldBeEnabled) {
     isEnabled_ = shouldBeEnabled;
@@ -144,14 +141,18 @@ void EventEmitter::setEnabled(bool enabled) const {
   // this to support an initial nebula state where the event target must be
   // retained without any associated mounted node.
   bool shouldBeRetained = enableCounter_ > 0;
-  if (shouldBeRetained != (eventTarget_ != nullptr)) {
-    if (!shouldBeRetained) {
-      eventTarget_.reset();
+  if (!shouldBeRetained && eventTarget_ != nullptr) {
+    auto eventTarget = SharedEventTarget{};
+    {
+      std::scoped_lock lock(eventTargetMutex());
+      eventTarget.swap(eventTarget_);
     }
+    // `eventTarget` may get deallocated here, outside of the lock.
   }
 }
 
-const SharedEventTarget& EventEmitter::getEventTarget() const {
+SharedEventTarget EventEmitter::getEventTarget() const {
+  std::scoped_lock lock(eventTargetMutex());
   return eventTarget_;
 }
 
@@ -14,6 +14,7 @@
 #include <react/renderer/core/EventDispatcher.h>
 #include <react/renderer/core/EventPayload.h>
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/EventType.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ValueFactoryEventPayload.h>
 
@@ -33,8 +34,16 @@ class EventEmitter {
  public:
   using Shared = std::shared_ptr<const EventEmitter>;
 
+  /*
+   * Same as `EventType::normalized`.
+   */
   static std::string normalizeEventType(std::string type);
 
+  /*
+   * Deprecated. Not used by the renderer anymore: `EventTarget` enablement is
+   * atomic, `eventTarget_` has its own synchronization and mount state is
+   * updated under the commit lock of the surface's `ShadowTree`.
+   */
   static std::mutex& DispatchMutex();
 
   static ValueFactory defaultPayloadFactory();
@@ -53,11 +62,16 @@ class EventEmitter {
    * a possibility to extract JSI value from it.
    * The enable state is additive; a number of `enable` calls should be equal to
    * a number of `disable` calls to release the event target.
-   * `DispatchMutex` must be acquired before calling.
+   * Calls must be serialized; the renderer calls it during a commit, under the
+   * commit lock of the `ShadowTree` the node belongs to.
    */
   void setEnabled(bool enabled) const;
 
-  const SharedEventTarget& getEventTarget() const;
+  /*
+   * Returns the event target, `nullptr` once the emitter got disabled.
+   * Can be called from any thread.
+   */
+  SharedEventTarget getEventTarget() const;
 
   /*
    * Experimental API that will change in the future.
@@ -76,39 +90,47 @@ class EventEmitter {
   /*
    * Initiates an event delivery process.
    * Is used by particular subclasses only.
+   * Event types of frequently dispatched events should be constructed once
+   * (e.g. as static variables) to avoid looking their names up every time.
    */
   void dispatchEvent(
-      std::string type,
+      EventType type,
       const ValueFactory& payloadFactory =
           EventEmitter::defaultPayloadFactory(),
       RawEvent::Category category = RawEvent::Category::Unspecified) const;
 
   void dispatchEvent(
-      std::string type,
+      EventType type,
       const folly::dynamic& payload,
       RawEvent::Category category = RawEvent::Category::Unspecified) const;
 
   void dispatchEvent(
-      std::string type,
+      EventType type,
       SharedEventPayload payload,
       RawEvent::Category category = RawEvent::Category::Unspecified) const;
 
-  void dispatchUniqueEvent(std::string type, const folly::dynamic& payload)
-      const;
+  void dispatchUniqueEvent(EventType type, const folly::dynamic& payload) const;
 
   void dispatchUniqueEvent(
-      std::string type,
+      EventType type,
       const ValueFactory& payloadFactory =
           EventEmitter::defaultPayloadFactory()) const;
 
-  void dispatchUniqueEvent(std::string type, SharedEventPayload payload) const;
+  void dispatchUniqueEvent(EventType type, SharedEventPayload payload) const;
 
  private:
   void toggleEventTargetOwnership_() const;
 
   friend class UIManagerBinding;
 
-  mutable SharedEventTarget eventTarget_;
+  /*
+   * Guards `eventTarget_` of this emitter. Mutexes are shared between
+   * emitters (by address) to keep emitters small; different emitters
+   * rarely map to the same one.
+   */
+  std::mutex& eventTargetMutex() const;
+
+  mutable SharedEventTarget eventTarget_; // Protected by `eventTargetMutex()`.
 
   EventDispatcher::Weak eventDispatcher_;
   mutable int enableCounter_{0};
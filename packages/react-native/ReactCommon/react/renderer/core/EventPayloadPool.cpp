@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventPayloadPool.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kSizeClassGranularity = 64;
+constexpr size_t kSizeClassCount =
+    EventPayloadPool::kMaxPooledSize / kSizeClassGranularity;
+
+// Bounds the memory retained by each size class after a burst of events.
+// Must be a power of two.
+constexpr size_t kMaxFreeBlocksPerSizeClass = 256;
+
+/*
+ * Bounded lock-free queue of free blocks (multiple producers, multiple
+ * consumers). Each cell carries a sequence number that tells whether it's
+ * ready to be written (`sequence == position`) or read
+ * (`sequence == position + 1`) at the given position.
+ */
+class FreeBlockQueue final {
+ public:
+  FreeBlockQueue() {
+    for (size_t i = 0; i < kMaxFreeBlocksPerSizeClass; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool push(void* block) {
+    auto position = pushPosition_.load(std::memory_order_relaxed);
+    while (true) {
+      auto& cell = cells_[position & kMask];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<intptr_t>(sequence) -
+          static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (pushPosition_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          cell.block = block;
+          cell.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        // Full.
+        return false;
+      } else {
+        position = pushPosition_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void* pop() {
+    auto position = popPosition_.load(std::memory_order_relaxed);
+    while (true) {
+      auto& cell = cells_[position & kMask];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<intptr_t>(sequence) -
+          static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (popPosition_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          auto block = cell.block;
+          cell.sequence.store(
+              position + kMaxFreeBlocksPerSizeClass,
+              std::memory_order_release);
+          return block;
+        }
+      } else if (difference < 0) {
+        // Empty.
+        return nullptr;
+      } else {
+        position = popPosition_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Approximate while blocks are being pushed or popped concurrently.
+  size_t size() const {
+    auto pushPosition = pushPosition_.load(std::memory_order_relaxed);
+    auto popPosition = popPosition_.load(std::memory_order_relaxed);
+    return pushPosition > popPosition ? pushPosition - popPosition : 0;
+  }
+
+ private:
+  static constexpr size_t kMask = kMaxFreeBlocksPerSizeClass - 1;
+  static_assert(
+      (kMaxFreeBlocksPerSizeClass & kMask) == 0,
+      "kMaxFreeBlocksPerSizeClass must be a power of two");
+
+  struct Cell {
+    std::atomic<size_t> sequence;
+    void* block;
+  };
+
+  std::array<Cell, kMaxFreeBlocksPerSizeClass> cells_;
+
+  // On separate cache lines: they are updated by different threads.
+  alignas(64) std::atomic<size_t> pushPosition_{0};
+  alignas(64) std::atomic<size_t> popPosition_{0};
+};
+
+std::array<FreeBlockQueue, kSizeClassCount>& sizeClasses() {
+  // Never destroyed: payloads can be released during static destruction.
+  static auto& sizeClasses =
+      *new std::array<FreeBlockQueue, kSizeClassCount>();
+  return sizeClasses;
+}
+
+size_t sizeClassIndex(size_t size) {
+  return (size - 1) / kSizeClassGranularity;
+}
+
+size_t sizeClassBlockSize(size_t index) {
+  return (index + 1) * kSizeClassGranularity;
+}
+
+} // namespace
+
+void* EventPayloadPool::allocate(size_t size) {
+  if (size == 0 || size > kMaxPooledSize) {
+    return ::operator new(size);
+  }
+
+  auto index = sizeClassIndex(size);
+  if (auto block = sizeClasses()[index].pop()) {
+    return block;
+  }
+
+  return ::operator new(sizeClassBlockSize(index));
+}
+
+void EventPayloadPool::deallocate(void* pointer, size_t size) noexcept {
+  if (size == 0 || size > kMaxPooledSize) {
+    ::operator delete(pointer);
+    return;
+  }
+
+  if (!sizeClasses()[sizeClassIndex(size)].push(pointer)) {
+    ::operator delete(pointer);
+  }
+}
+
+size_t EventPayloadPool::getFreeBlockCount() {
+  auto count = size_t{0};
+  for (const auto& sizeClass : sizeClasses()) {
+    count += sizeClass.size();
+  }
+  return count;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * Recycles the memory of event payloads.
+ * Payloads are allocated on the thread dispatching an event and released on
+ * the JavaScript thread once the event queue has been flushed. Instead of
+ * returning their memory to the system allocator, released blocks are kept in
+ * per-size free lists and handed out to the next payloads of a similar size,
+ * so in steady state high-frequency events don't allocate.
+ * Unlike `ShadowNodeAllocationPool`, whose blocks mostly come back to the
+ * thread that allocated them, the free lists are shared by all threads (a
+ * per-thread cache on the JavaScript thread would never be drained); they
+ * are bounded lock-free queues, so neither side ever blocks.
+ * Thread-safe.
+ */
+class EventPayloadPool final {
+ public:
+  /*
+   * Blocks larger than this are not pooled.
+   */
+  static constexpr size_t kMaxPooledSize = 1024;
+
+  static void* allocate(size_t size);
+  static void deallocate(void* pointer, size_t size) noexcept;
+
+  /*
+   * Number of free blocks currently held by the pool (approximate while
+   * payloads are allocated or released concurrently).
+   */
+  static size_t getFreeBlockCount();
+};
+
+/*
+ * Standard allocator backed by `EventPayloadPool`.
+ */
+template <typename T>
+class EventPayloadAllocator {
+ public:
+  using value_type = T;
+
+  static_assert(
+      alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+      "Over-aligned payloads are not supported");
+
+  EventPayloadAllocator() noexcept = default;
+
+  template <typename U>
+  EventPayloadAllocator(const EventPayloadAllocator<U>& /*other*/) noexcept {}
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(EventPayloadPool::allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept {
+    EventPayloadPool::deallocate(pointer, count * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(const EventPayloadAllocator<U>& /*rhs*/) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const EventPayloadAllocator<U>& /*rhs*/) const noexcept {
+    return false;
+  }
+};
+
+/*
+ * Same as `std::make_shared`, but the payload (together with its control
+ * block) is allocated from `EventPayloadPool`.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> makeSharedEventPayload(Args&&... args) {
+  return std::allocate_shared<T>(
+      EventPayloadAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+} // namespace facebook::react
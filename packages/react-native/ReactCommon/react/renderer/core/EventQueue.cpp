@@ -113,11 +113,21 @@ void EventQueue::flushEvents(jsi::Runtime& runtime) const {
       return;
     }
 
-    queue = std::move(eventQueue_);
-    eventQueue_.clear();
+    queue.swap(eventQueue_);
+    eventQueue_.swap(recycledEventQueue_);
   }
 
-  eventProcessor_.flushEvents(runtime, std::move(queue));
+  eventProcessor_.flushEvents(runtime, queue);
+
+  // Releases payloads and targets, keeping the storage for the next flush.
+  queue.clear();
+
+  {
+    std::scoped_lock lock(queueMutex_);
+    if (queue.capacity() > recycledEventQueue_.capacity()) {
+      recycledEventQueue_.swap(queue);
+    }
+  }
 }
 
 void EventQueue::flushStateUpdates() const {
@@ -74,6 +74,9 @@ class EventQueue {
   // Thread-safe, protected by `queueMutex_`.
   mutable std::vector<RawEvent> eventQueue_;
   mutable std::vector<StateUpdate> stateUpdateQueue_;
+  // Empty queue whose storage is reused by the next batch of events, so that
+  // enqueuing doesn't reallocate after every flush.
+  mutable std::vector<RawEvent> recycledEventQueue_;
   mutable std::mutex queueMutex_;
 
   // TODO: T183075253
@@ -5,9 +5,14 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
+
 #include <cxxreact/JSExecutor.h>
 #include <logger/react_native_log.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
+#include <react/utils/Telemetry.h>
+#include <reactperflogger/fusebox/FuseboxTracer.h>
 #include "EventEmitter.h"
 #include "EventLogger.h"
 #include "EventQueue.h"
@@ -15,29 +20,38 @@
 
 namespace facebook::react {
 
+static thread_local TelemetryTimePoint oldestUncommittedEventTime =
+    kTelemetryUndefinedTimePoint;
+
 EventQueueProcessor::EventQueueProcessor(
     EventPipe eventPipe,
     EventPipeConclusion eventPipeConclusion,
     StatePipe statePipe,
-    std::weak_ptr<EventLogger> eventLogger)
+    std::weak_ptr<EventLogger> eventLogger,
+    StateBatchPipe stateBatchPipe)
     : eventPipe_(std::move(eventPipe)),
       eventPipeConclusion_(std::move(eventPipeConclusion)),
       statePipe_(std::move(statePipe)),
+      stateBatchPipe_(std::move(stateBatchPipe)),
       eventLogger_(std::move(eventLogger)) {}
 
 void EventQueueProcessor::flushEvents(
     jsi::Runtime& runtime,
-    std::vector<RawEvent>&& events) const {
-  {
-    std::scoped_lock lock(EventEmitter::DispatchMutex());
-
-    for (const auto& event : events) {
-      if (event.eventTarget) {
-        event.eventTarget->retain(runtime);
-      }
+    const std::vector<RawEvent>& events) const {
+  for (const auto& event : events) {
+    if (event.eventTarget) {
+      event.eventTarget->retain(runtime);
     }
   }
 
+  for (const auto& event : events) {
+    oldestUncommittedEventTime =
+        std::min(oldestUncommittedEventTime, event.dispatchTime);
+  }
+
+  auto& tracer = FuseboxTracer::getFuseboxTracer();
+  auto isTracing = tracer.isTracing();
+
   for (const auto& event : events) {
     auto reactPriority = ReactEventPriority::Default;
 
@@ -89,12 +103,30 @@ void EventQueueProcessor::flushEvents(
       continue;
     }
 
-    eventPipe_(
-        runtime,
-        event.eventTarget.get(),
-        event.type,
-        reactPriority,
-        *event.eventPayload);
+    auto dispatchStartTime =
+        isTracing ? telemetryTimePointNow() : TelemetryTimePoint{};
+
+    {
+      ScopedEventCausality causality(event.loggingTag);
+      eventPipe_(
+          runtime,
+          event.eventTarget.get(),
+          event.type.getName(),
+          reactPriority,
+          *event.eventPayload);
+    }
+
+    // Updates scheduled by the handlers are usually flushed after the whole
+    // batch of events is dispatched, still within the current task.
+    attributeCurrentScopeToEvent(event.loggingTag);
+
+    if (isTracing) {
+      tracer.addEvent(
+          event.type.getName(),
+          dispatchStartTime,
+          telemetryTimePointNow(),
+          "Fabric: Event Dispatch");
+    }
 
     if (eventLogger != nullptr) {
       eventLogger->onEventProcessingEnd(event.loggingTag);
@@ -108,10 +140,6 @@ void EventQueueProcessor::flushEvents(
   // We only run the "Conclusion" once per event group when batched.
   eventPipeConclusion_(runtime);
 
-  // No need to lock `EventEmitter::DispatchMutex()` here.
-  // The mutex protects from a situation when the `instanceHandle` can be
-  // deallocated during accessing, but that's impossible at this point because
-  // we have a strong pointer to it.
   for (const auto& event : events) {
     if (event.eventTarget) {
       event.eventTarget->release(runtime);
@@ -119,8 +147,22 @@ void EventQueueProcessor::flushEvents(
   }
 }
 
+/* static */ TelemetryTimePoint
+EventQueueProcessor::getOldestUncommittedEventTime() {
+  return oldestUncommittedEventTime;
+}
+
+/* static */ void EventQueueProcessor::resetOldestUncommittedEventTime() {
+  oldestUncommittedEventTime = kTelemetryUndefinedTimePoint;
+}
+
 void EventQueueProcessor::flushStateUpdates(
     std::vector<StateUpdate>&& states) const {
+  if (stateBatchPipe_ && states.size() > 1) {
+    stateBatchPipe_(states);
+    return;
+  }
+
   for (const auto& stateUpdate : states) {
     statePipe_(stateUpdate);
   }
@@ -23,15 +23,28 @@ class EventQueueProcessor {
       EventPipe eventPipe,
       EventPipeConclusion eventPipeConclusion,
       StatePipe statePipe,
-      std::weak_ptr<EventLogger> eventLogger);
+      std::weak_ptr<EventLogger> eventLogger,
+      StateBatchPipe stateBatchPipe = nullptr);
 
-  void flushEvents(jsi::Runtime& runtime, std::vector<RawEvent>&& events) const;
+  void flushEvents(jsi::Runtime& runtime, const std::vector<RawEvent>& events)
+      const;
   void flushStateUpdates(std::vector<StateUpdate>&& states) const;
 
+  /*
+   * Returns the dispatch time of the oldest event processed on the calling
+   * thread since the last call to `resetOldestUncommittedEventTime()`, or
+   * `kTelemetryUndefinedTimePoint` if there was none.
+   * Used to measure the latency from input to mount of the commit that
+   * follows.
+   */
+  static TelemetryTimePoint getOldestUncommittedEventTime();
+  static void resetOldestUncommittedEventTime();
+
  private:
   const EventPipe eventPipe_;
   const EventPipeConclusion eventPipeConclusion_;
   const StatePipe statePipe_;
+  const StateBatchPipe stateBatchPipe_;
   const std::weak_ptr<EventLogger> eventLogger_;
 
   mutable bool hasContinuousEventStarted_{false};
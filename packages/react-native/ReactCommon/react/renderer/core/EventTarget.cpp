@@ -21,11 +21,13 @@ EventTarget::EventTarget(
       strongInstanceHandle_(jsi::Value::null()) {}
 
 void EventTarget::setEnabled(bool enabled) const {
-  enabled_ = enabled;
+  enabled_.store(enabled, std::memory_order_release);
 }
 
 void EventTarget::retain(jsi::Runtime& runtime) const {
-  if (!enabled_) {
+  // A target can get disabled right after the check; that's fine because the
+  // JavaScript object it points to can only be collected on this thread.
+  if (!enabled_.load(std::memory_order_acquire)) {
     return;
   }
 
@@ -9,6 +9,7 @@
 
 #include <jsi/jsi.h>
 #include <react/renderer/core/InstanceHandle.h>
+#include <atomic>
 #include <memory>
 
 namespace facebook::react {
@@ -41,6 +42,7 @@ class EventTarget {
   /*
    * Sets the `enabled` flag that allows creating a strong instance handle from
    * a weak one.
+   * Can be called from any thread.
    */
   void setEnabled(bool enabled) const;
 
@@ -71,7 +73,7 @@ class EventTarget {
  private:
   const InstanceHandle::Shared instanceHandle_;
   const SurfaceId surfaceId_;
-  mutable bool enabled_{false}; // Protected by `EventEmitter::DispatchMutex()`.
+  mutable std::atomic<bool> enabled_{false};
   mutable jsi::Value strongInstanceHandle_; // Protected by `jsi::Runtime &`.
   mutable size_t retainCount_{0}; // Protected by `jsi::Runtime &`.
 };
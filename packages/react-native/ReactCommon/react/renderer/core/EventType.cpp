@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventType.h"
+
+#include <atomic>
+#include <cctype>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace facebook::react {
+
+struct EventType::Entry {
+  Entry(std::string name, Id id) : name(std::move(name)), id(id) {}
+
+  const std::string name;
+  const Id id;
+  // Entry of the normalized name, resolved lazily.
+  mutable std::atomic<const Entry*> normalized{nullptr};
+};
+
+class EventType::Table final {
+ public:
+  static Table& shared() {
+    // Never destroyed: event types can be used during static destruction.
+    static auto& table = *new Table();
+    return table;
+  }
+
+  const Entry* find(std::string_view name) const {
+    std::shared_lock lock(mutex_);
+    auto iterator = entries_.find(name);
+    return iterator != entries_.end() ? iterator->second : nullptr;
+  }
+
+  const Entry* insert(std::string_view name) {
+    std::unique_lock lock(mutex_);
+    auto iterator = entries_.find(name);
+    if (iterator != entries_.end()) {
+      return iterator->second;
+    }
+
+    // `std::deque` never moves its elements, so the keys (which point into
+    // the stored names) and the returned pointers stay valid.
+    const auto& entry = storage_.emplace_back(
+        std::string{name}, static_cast<Id>(storage_.size()));
+    entries_.emplace(entry.name, &entry);
+    return &entry;
+  }
+
+ private:
+  mutable std::shared_mutex mutex_;
+  std::deque<Entry> storage_; // Protected by `mutex_`.
+  std::unordered_map<std::string_view, const Entry*>
+      entries_; // Protected by `mutex_`.
+};
+
+namespace {
+
+bool hasPrefix(std::string_view string, std::string_view prefix) {
+  return string.compare(0, prefix.size(), prefix) == 0;
+}
+
+// TODO(T29874519): Get rid of "top" prefix once and for all.
+/*
+ * Replaces "on" with "top" if present. Or capitalizes the first letter and adds
+ * "top" prefix. E.g. "eventName" becomes "topEventName", "onEventName" also
+ * becomes "topEventName".
+ */
+std::string normalizeName(std::string_view name) {
+  if (hasPrefix(name, "top")) {
+    return std::string{name};
+  }
+  if (hasPrefix(name, "on")) {
+    return "top" + std::string{name.substr(2)};
+  }
+  auto normalizedName = "top" + std::string{name};
+  if (normalizedName.size() > 3) {
+    normalizedName[3] = static_cast<char>(toupper(normalizedName[3]));
+  }
+  return normalizedName;
+}
+
+} // namespace
+
+const EventType::Entry* EventType::intern(std::string_view name) {
+  auto& table = Table::shared();
+  if (auto entry = table.find(name)) {
+    return entry;
+  }
+  return table.insert(name);
+}
+
+EventType::EventType(std::string_view name) : entry_(intern(name)) {}
+
+EventType::EventType(const char* name)
+    : EventType(std::string_view{name}) {}
+
+EventType::EventType(const std::string& name)
+    : EventType(std::string_view{name}) {}
+
+EventType::Id EventType::getId() const noexcept {
+  return entry_->id;
+}
+
+const std::string& EventType::getName() const noexcept {
+  return entry_->name;
+}
+
+EventType EventType::normalized() const {
+  auto normalizedEntry = entry_->normalized.load(std::memory_order_acquire);
+  if (normalizedEntry == nullptr) {
+    // Racing threads resolve the same entry, so the store is idempotent.
+    normalizedEntry = intern(normalizeName(entry_->name));
+    entry_->normalized.store(normalizedEntry, std::memory_order_release);
+  }
+  return EventType{normalizedEntry};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace facebook::react {
+
+/*
+ * Interned name of an event type.
+ * Every distinct name is stored once per process and gets a small integer
+ * identifier, so copying and comparing event types doesn't touch strings.
+ * Constructing an `EventType` from a name looks the name up in a global table
+ * (and only allocates the first time the name is seen); code dispatching
+ * events at a high rate should construct its event types once and reuse them.
+ * Thread-safe.
+ */
+class EventType final {
+ public:
+  using Id = uint32_t;
+
+  EventType(std::string_view name);
+  EventType(const char* name);
+  EventType(const std::string& name);
+
+  /*
+   * Sequential identifier of the type, unique within the process.
+   */
+  Id getId() const noexcept;
+
+  /*
+   * The name of the type. The reference stays valid for the lifetime of the
+   * process.
+   */
+  const std::string& getName() const noexcept;
+
+  /*
+   * Returns the type with the name in the form the JavaScript side expects
+   * (see `EventEmitter::normalizeEventType`), for example `scroll` and
+   * `onScroll` both become `topScroll`. Computed once per type.
+   */
+  EventType normalized() const;
+
+  bool operator==(const EventType& rhs) const noexcept {
+    return entry_ == rhs.entry_;
+  }
+
+  bool operator!=(const EventType& rhs) const noexcept {
+    return entry_ != rhs.entry_;
+  }
+
+ private:
+  struct Entry;
+  class Table;
+
+  explicit EventType(const Entry* entry) noexcept : entry_(entry) {}
+
+  static const Entry* intern(std::string_view name);
+
+  const Entry* entry_;
+};
+
+} // namespace facebook::react
+
+namespace std {
+
+template <>
+struct hash<facebook::react::EventType> {
+  size_t operator()(const facebook::react::EventType& eventType) const {
+    return std::hash<facebook::react::EventType::Id>{}(eventType.getId());
+  }
+};
+
+} // namespace std
@@ -10,13 +10,14 @@
 namespace facebook::react {
 
 RawEvent::RawEvent(
-    std::string type,
+    EventType type,
     SharedEventPayload eventPayload,
     SharedEventTarget eventTarget,
     Category category)
-    : type(std::move(type)),
+    : type(type),
       eventPayload(std::move(eventPayload)),
       eventTarget(std::move(eventTarget)),
-      category(category) {}
+      category(category),
+      dispatchTime(telemetryTimePointNow()) {}
 
 } // namespace facebook::react
@@ -8,11 +8,12 @@
 #pragma once
 
 #include <memory>
-#include <string>
 
 #include <react/renderer/core/EventLogger.h>
 #include <react/renderer/core/EventPayload.h>
 #include <react/renderer/core/EventTarget.h>
+#include <react/renderer/core/EventType.h>
+#include <react/utils/Telemetry.h>
 
 namespace facebook::react {
 
@@ -59,16 +60,21 @@ struct RawEvent {
   };
 
   RawEvent(
-      std::string type,
+      EventType type,
       SharedEventPayload eventPayload,
       SharedEventTarget eventTarget,
       Category category = Category::Unspecified);
 
-  std::string type;
+  EventType type;
   SharedEventPayload eventPayload;
   SharedEventTarget eventTarget;
   Category category;
   EventTag loggingTag{0};
+
+  /*
+   * Time at which the platform dispatched the event.
+   */
+  TelemetryTimePoint dispatchTime;
 };
 
 } // namespace facebook::react
@@ -16,6 +16,7 @@
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace facebook::react {
@@ -80,8 +81,10 @@ ShadowNode::ShadowNode(
   traits_.set(ShadowNodeTraits::Trait::ChildrenAreShared);
   traits_.set(fragment.traits.get());
 
-  for (const auto& child : *children_) {
-    child->family_->setParent(family_);
+  for (size_t index = 0; index < children_->size(); index++) {
+    const auto& childFamily = *(*children_)[index]->family_;
+    childFamily.setParent(family_);
+    childFamily.setChildIndexHint(index);
   }
 
   // The first node of the family gets its state committed automatically.
@@ -115,8 +118,10 @@ ShadowNode::ShadowNode(
   traits_.set(fragment.traits.get());
 
   if (fragment.children) {
-    for (const auto& child : *children_) {
-      child->family_->setParent(family_);
+    for (size_t index = 0; index < children_->size(); index++) {
+      const auto& childFamily = *(*children_)[index]->family_;
+      childFamily.setParent(family_);
+      childFamily.setChildIndexHint(index);
     }
   }
 }
@@ -236,6 +241,7 @@ void ShadowNode::appendChild(const ShadowNode::Shared& child) {
   children.push_back(child);
 
   child->family_->setParent(family_);
+  child->family_->setChildIndexHint(children.size() - 1);
 }
 
 void ShadowNode::replaceChild(
@@ -256,6 +262,7 @@ void ShadowNode::replaceChild(
     // replacing in place using the index.
     if (children.at(suggestedIndex).get() == &oldChild) {
       children[suggestedIndex] = newChild;
+      newChild->family_->setChildIndexHint(suggestedIndex);
       return;
     }
   }
@@ -263,6 +270,7 @@ void ShadowNode::replaceChild(
   for (size_t index = 0; index < size; index++) {
     if (children.at(index).get() == &oldChild) {
       children[index] = newChild;
+      newChild->family_->setChildIndexHint(index);
       return;
     }
   }
@@ -276,7 +284,7 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<ShadowNode::ListOfShared>(*children_);
+  children_ = makeSharedChildrenList<ShadowNode::ListOfShared>(*children_);
 }
 
 void ShadowNode::setMounted(bool mounted) const {
@@ -370,13 +378,98 @@ ShadowNode::Unshared ShadowNode::cloneTree(
     children[childIndex] = childNode;
 
     childNode = parentNode.clone(
-        {.children = std::make_shared<ShadowNode::ListOfShared>(children),
+        {.children =
+             makeSharedChildrenList<ShadowNode::ListOfShared>(children),
          .traits = traits});
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+namespace {
+
+using ChildIndicesMap =
+    std::unordered_map<const ShadowNode*, std::vector<int>>;
+
+/*
+ * Returns the clone of `oldShadowNode` with all affected descendants
+ * replaced, or `nullptr` if nothing in the subtree changed.
+ */
+ShadowNode::Unshared cloneTreeRecursively(
+    const ShadowNode& oldShadowNode,
+    const ChildIndicesMap& childIndicesToClone,
+    const ShadowNode::CloneTreeCallbacks& callbacks,
+    ShadowNodeTraits traits) {
+  auto children = ShadowNode::UnsharedListOfShared{};
+
+  auto childIndices = childIndicesToClone.find(&oldShadowNode);
+  if (childIndices != childIndicesToClone.end()) {
+    const auto& oldChildren = oldShadowNode.getChildren();
+    for (auto childIndex : childIndices->second) {
+      auto newChild = cloneTreeRecursively(
+          *oldChildren.at(childIndex), childIndicesToClone, callbacks, traits);
+      if (!newChild) {
+        continue;
+      }
+
+      if (!children) {
+        children =
+            makeSharedChildrenList<ShadowNode::ListOfShared>(oldChildren);
+      }
+      react_native_assert(
+          ShadowNode::sameFamily(*children->at(childIndex), *newChild));
+      (*children)[childIndex] = std::move(newChild);
+    }
+  }
+
+  // Stays empty, which is what `childrenPlaceholder()` is, if no child
+  // changed.
+  const auto sharedChildren =
+      ShadowNode::SharedListOfShared{std::move(children)};
+
+  auto callback = callbacks.find(&oldShadowNode.getFamily());
+  if (callback != callbacks.end()) {
+    auto newShadowNode =
+        callback->second(oldShadowNode, {.children = sharedChildren});
+    if (newShadowNode) {
+      return newShadowNode;
+    }
+  }
+
+  if (!sharedChildren) {
+    return nullptr;
+  }
+
+  return oldShadowNode.clone({.children = sharedChildren, .traits = traits});
+}
+
+} // namespace
+
+ShadowNode::Unshared ShadowNode::cloneTree(
+    const CloneTreeCallbacks& callbacks,
+    ShadowNodeTraits traits) const {
+  // For every node on the way down to one of the families, the indices of its
+  // children that are on the way as well. Paths of different families share
+  // their common prefix here, which is what makes every ancestor cloned once.
+  auto childIndicesToClone = ChildIndicesMap{};
+
+  for (const auto& [family, callback] : callbacks) {
+    for (const auto& [parentNode, childIndex] : family->getAncestors(*this)) {
+      auto& childIndices = childIndicesToClone[&parentNode.get()];
+      if (std::find(childIndices.begin(), childIndices.end(), childIndex) ==
+          childIndices.end()) {
+        childIndices.push_back(childIndex);
+      }
+    }
+  }
+
+  if (childIndicesToClone.empty()) {
+    return ShadowNode::Unshared{nullptr};
+  }
+
+  return cloneTreeRecursively(*this, childIndicesToClone, callbacks, traits);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -11,12 +11,14 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <react/renderer/core/EventEmitter.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/Sealable.h>
+#include <react/renderer/core/ShadowNodeAllocation.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
 #include <react/renderer/core/ShadowNodeTraits.h>
 #include <react/renderer/core/State.h>
@@ -45,6 +47,12 @@ class ShadowNode : public Sealable,
       std::reference_wrapper<const ShadowNode> /* parentNode */,
       int /* childIndex */>>;
 
+  using CloneTreeCallbacks = std::unordered_map<
+      const ShadowNodeFamily*,
+      std::function<Unshared(
+          const ShadowNode& oldShadowNode,
+          const ShadowNodeFragment& fragment)>>;
+
   static SharedListOfShared emptySharedShadowNodeSharedList();
 
   /*
@@ -105,6 +113,24 @@ class ShadowNode : public Sealable,
       const std::function<Unshared(const ShadowNode& oldShadowNode)>& callback,
       ShadowNodeTraits traits = {}) const;
 
+  /*
+   * Multi-target version of `cloneTree`: replaces the nodes of all families
+   * in `callbacks` in a single pass. The union of their ancestor paths is
+   * cloned once, so an ancestor shared by several families is cloned only
+   * once, with all of its updated children.
+   *
+   * A callback receives the old node and a fragment holding its updated
+   * children (`childrenPlaceholder()` unless the family is an ancestor of
+   * another one) that the returned clone must use. Returning `nullptr` keeps
+   * the node as it is, apart from its children. Families that are not part
+   * of the tree are ignored.
+   *
+   * Returns `nullptr` if no node was replaced.
+   */
+  Unshared cloneTree(
+      const CloneTreeCallbacks& callbacks,
+      ShadowNodeTraits traits = {}) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -168,7 +194,8 @@ class ShadowNode : public Sealable,
   /*
    * Performs all side effects associated with mounting/unmounting in one place.
    * This is not `virtual` on purpose, do not override this.
-   * `EventEmitter::DispatchMutex()` must be acquired before calling.
+   * Must be called under the commit lock of the `ShadowTree` the node belongs
+   * to.
    */
   void setMounted(bool mounted) const;
 
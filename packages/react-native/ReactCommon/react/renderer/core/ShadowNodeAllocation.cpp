@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeAllocation.h"
+
+#include <array>
+#include <vector>
+
+#include <react/utils/CoreFeatures.h>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kSizeClassGranularity = 64;
+constexpr size_t kSizeClassCount =
+    ShadowNodeAllocationPool::kMaxPooledSize / kSizeClassGranularity;
+
+// Bounds the memory retained by each size class after a large commit.
+constexpr size_t kMaxFreeBlocksPerSizeClass = 512;
+
+size_t sizeClassIndex(size_t size) {
+  return (size - 1) / kSizeClassGranularity;
+}
+
+size_t sizeClassBlockSize(size_t index) {
+  return (index + 1) * kSizeClassGranularity;
+}
+
+// Trivially destructible, so they stay usable while thread-local objects
+// are being destroyed.
+thread_local bool isThreadCacheDestroyed = false;
+thread_local ShadowNodeAllocationCount threadAllocationCount{};
+
+class ThreadCache final {
+ public:
+  ~ThreadCache() {
+    isThreadCacheDestroyed = true;
+    for (auto& freeBlocks : freeBlocks_) {
+      for (auto block : freeBlocks) {
+        ::operator delete(block);
+      }
+    }
+  }
+
+  void* pop(size_t index) {
+    auto& freeBlocks = freeBlocks_[index];
+    if (freeBlocks.empty()) {
+      // Reserved here so that `push` never has to allocate.
+      freeBlocks.reserve(kMaxFreeBlocksPerSizeClass);
+      return nullptr;
+    }
+    auto block = freeBlocks.back();
+    freeBlocks.pop_back();
+    return block;
+  }
+
+  bool push(size_t index, void* block) {
+    // Only size classes this thread allocated from have reserved storage,
+    // so threads that merely release nodes don't hoard blocks.
+    auto& freeBlocks = freeBlocks_[index];
+    if (freeBlocks.size() == freeBlocks.capacity()) {
+      return false;
+    }
+    freeBlocks.push_back(block);
+    return true;
+  }
+
+  size_t getFreeBlockCount() const {
+    auto count = size_t{0};
+    for (const auto& freeBlocks : freeBlocks_) {
+      count += freeBlocks.size();
+    }
+    return count;
+  }
+
+ private:
+  std::array<std::vector<void*>, kSizeClassCount> freeBlocks_;
+};
+
+ThreadCache* getThreadCache() {
+  if (isThreadCacheDestroyed) {
+    // Nodes can be released while the thread is shutting down.
+    return nullptr;
+  }
+  thread_local ThreadCache cache;
+  return &cache;
+}
+
+} // namespace
+
+void* ShadowNodeAllocationPool::allocate(size_t size) {
+  if (size == 0 || size > kMaxPooledSize) {
+    return ::operator new(size);
+  }
+
+  if (!CoreFeatures::enableShadowNodeAllocationPool) {
+    return ::operator new(size);
+  }
+
+  // Pooled blocks are rounded up to their size class, so they can be
+  // handed out to any node of the same class.
+  auto index = sizeClassIndex(size);
+  if (auto cache = getThreadCache()) {
+    if (auto block = cache->pop(index)) {
+      return block;
+    }
+  }
+
+  return ::operator new(sizeClassBlockSize(index));
+}
+
+void ShadowNodeAllocationPool::deallocate(void* pointer, size_t size) noexcept {
+  if (size != 0 && size <= kMaxPooledSize &&
+      CoreFeatures::enableShadowNodeAllocationPool) {
+    if (auto cache = getThreadCache()) {
+      if (cache->push(sizeClassIndex(size), pointer)) {
+        return;
+      }
+    }
+  }
+
+  ::operator delete(pointer);
+}
+
+size_t ShadowNodeAllocationPool::getThreadFreeBlockCount() {
+  auto cache = getThreadCache();
+  return cache != nullptr ? cache->getFreeBlockCount() : 0;
+}
+
+ShadowNodeAllocationCount getThreadShadowNodeAllocationCount() {
+  return threadAllocationCount;
+}
+
+namespace detail {
+
+void countShadowNodeAllocation() {
+  threadAllocationCount.shadowNodes++;
+}
+
+void countChildrenListAllocation() {
+  threadAllocationCount.childrenLists++;
+}
+
+} // namespace detail
+
+} // namespace facebook::react
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * Recycles the memory of shadow nodes and children lists.
+ * Every commit clones the path from each changed node to the root and
+ * builds new children lists for the clones; most of them are released again
+ * once a newer revision has been mounted. Released blocks are kept in
+ * per-thread, per-size free lists and handed out to the next nodes of a
+ * similar size, so steady-state commits mostly don't reach `malloc`.
+ * Per-thread caches (rather than locked shared ones) keep the allocation
+ * path free of synchronization; a block released on another thread simply
+ * ends up in that thread's cache.
+ * Pooling is enabled with `CoreFeatures::enableShadowNodeAllocationPool`;
+ * allocations are counted either way. When it's disabled, blocks have their
+ * exact size, so the flag must not change while shadow nodes are alive.
+ */
+class ShadowNodeAllocationPool final {
+ public:
+  /*
+   * Blocks larger than this are not pooled.
+   */
+  static constexpr size_t kMaxPooledSize = 2048;
+
+  static void* allocate(size_t size);
+  static void deallocate(void* pointer, size_t size) noexcept;
+
+  /*
+   * Number of free blocks currently held by the calling thread's cache.
+   */
+  static size_t getThreadFreeBlockCount();
+};
+
+/*
+ * Number of shadow nodes and children lists allocated on the calling thread
+ * since it started. The difference of two readings is the number of
+ * allocations made in between.
+ */
+struct ShadowNodeAllocationCount {
+  size_t shadowNodes{0};
+  size_t childrenLists{0};
+};
+
+ShadowNodeAllocationCount getThreadShadowNodeAllocationCount();
+
+/*
+ * Standard allocator backed by `ShadowNodeAllocationPool`.
+ */
+template <typename T>
+class ShadowNodeAllocator {
+ public:
+  using value_type = T;
+
+  static_assert(
+      alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+      "Over-aligned shadow nodes are not supported");
+
+  ShadowNodeAllocator() noexcept = default;
+
+  template <typename U>
+  ShadowNodeAllocator(const ShadowNodeAllocator<U>& /*other*/) noexcept {}
+
+  T* allocate(size_t count) {
+    return static_cast<T*>(
+        ShadowNodeAllocationPool::allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept {
+    ShadowNodeAllocationPool::deallocate(pointer, count * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(const ShadowNodeAllocator<U>& /*rhs*/) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const ShadowNodeAllocator<U>& /*rhs*/) const noexcept {
+    return false;
+  }
+};
+
+namespace detail {
+void countShadowNodeAllocation();
+void countChildrenListAllocation();
+} // namespace detail
+
+/*
+ * Same as `std::make_shared`, but the shadow node (together with its control
+ * block) is allocated from `ShadowNodeAllocationPool`.
+ */
+template <typename ShadowNodeT, typename... Args>
+std::shared_ptr<ShadowNodeT> makeSharedShadowNode(Args&&... args) {
+  detail::countShadowNodeAllocation();
+  return std::allocate_shared<ShadowNodeT>(
+      ShadowNodeAllocator<ShadowNodeT>{}, std::forward<Args>(args)...);
+}
+
+/*
+ * Same as `std::make_shared`, but the children list (together with its
+ * control block) is allocated from `ShadowNodeAllocationPool`.
+ * Only the list object is pooled; its element buffer uses the list's own
+ * allocator.
+ */
+template <typename ListT, typename... Args>
+std::shared_ptr<ListT> makeSharedChildrenList(Args&&... args) {
+  detail::countChildrenListAllocation();
+  return std::allocate_shared<ListT>(
+      ShadowNodeAllocator<ListT>{}, std::forward<Args>(args)...);
+}
+
+} // namespace facebook::react
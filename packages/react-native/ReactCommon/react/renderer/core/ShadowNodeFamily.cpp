@@ -42,6 +42,11 @@ void ShadowNodeFamily::setParent(const ShadowNodeFamily::Shared& parent) const {
   hasParent_ = true;
 }
 
+void ShadowNodeFamily::setChildIndexHint(size_t childIndex) const {
+  childIndexHint_.store(
+      static_cast<uint32_t>(childIndex), std::memory_order_relaxed);
+}
+
 ComponentHandle ShadowNodeFamily::getComponentHandle() const {
   return componentHandle_;
 }
@@ -50,6 +55,10 @@ SurfaceId ShadowNodeFamily::getSurfaceId() const {
   return surfaceId_;
 }
 
+Tag ShadowNodeFamily::getTag() const {
+  return tag_;
+}
+
 SharedEventEmitter ShadowNodeFamily::getEventEmitter() const {
   return eventEmitter_;
 }
@@ -78,25 +87,35 @@ AncestorList ShadowNodeFamily::getAncestors(
   }
 
   auto ancestors = AncestorList{};
+  ancestors.reserve(families.size());
   auto parentNode = &ancestorShadowNode;
   for (auto it = families.rbegin(); it != families.rend(); it++) {
     auto childFamily = *it;
-    auto found = false;
-    auto childIndex = 0;
-    for (const auto& childNode : *parentNode->children_) {
-      if (childNode->family_.get() == childFamily) {
-        ancestors.emplace_back(*parentNode, childIndex);
-        parentNode = childNode.get();
-        found = true;
-        break;
+    const auto& children = *parentNode->children_;
+    auto childIndex =
+        static_cast<size_t>(childFamily->childIndexHint_.load(
+            std::memory_order_relaxed));
+
+    if (childIndex >= children.size() ||
+        children[childIndex]->family_.get() != childFamily) {
+      // The hint is stale (e.g. `ancestorShadowNode` is from an older
+      // revision), falling back to the scan.
+      childIndex = children.size();
+      for (size_t index = 0; index < children.size(); index++) {
+        if (children[index]->family_.get() == childFamily) {
+          childIndex = index;
+          break;
+        }
       }
-      childIndex++;
-    }
 
-    if (!found) {
-      ancestors.clear();
-      return ancestors;
+      if (childIndex == children.size()) {
+        ancestors.clear();
+        return ancestors;
+      }
     }
+
+    ancestors.emplace_back(*parentNode, static_cast<int>(childIndex));
+    parentNode = children[childIndex].get();
   }
 
   return ancestors;
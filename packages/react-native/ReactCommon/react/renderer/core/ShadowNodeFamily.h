@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 
@@ -79,12 +80,16 @@ class ShadowNodeFamily final {
    * node and an index of the child of the parent node.
    * Returns an empty array if there is no ancestor-descendant relationship.
    * Can be called from any thread.
-   * The theoretical complexity of the algorithm is `O(ln(n))`. Use it wisely.
+   * The complexity is `O(depth)` as long as the child index hints of the
+   * families on the way are accurate for the given tree (which is the case for
+   * the most recent tree); a stale hint costs a scan of the parent's children.
    */
   AncestorList getAncestors(const ShadowNode& ancestorShadowNode) const;
 
   SurfaceId getSurfaceId() const;
 
+  Tag getTag() const;
+
   SharedEventEmitter getEventEmitter() const;
 
   /*
@@ -117,6 +122,13 @@ class ShadowNodeFamily final {
   std::shared_ptr<const State> getMostRecentStateIfObsolete(
       const State& state) const;
 
+  /*
+   * Records the position of the most recently created node of this family
+   * among the children of its parent.
+   * To be used by `ShadowNode` only.
+   */
+  void setChildIndexHint(size_t childIndex) const;
+
   EventDispatcher::Weak eventDispatcher_;
   mutable std::shared_ptr<const State> mostRecentState_;
   mutable std::shared_mutex mutex_;
@@ -165,6 +177,14 @@ class ShadowNodeFamily final {
    * For optimization purposes only.
    */
   mutable bool hasParent_{false};
+
+  /*
+   * Index of a node of this family in the children list of its parent as of
+   * the last time it was placed there. It's a hint only: it must be validated
+   * against the actual list before use, because different revisions of the
+   * parent can have the node at different positions.
+   */
+  mutable std::atomic<uint32_t> childIndexHint_{0};
 };
 
 } // namespace facebook::react
@@ -7,15 +7,20 @@
 
 #pragma once
 
+#include <vector>
+
 #ifdef ANDROID
 #include <folly/dynamic.h>
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #endif
 
 #include <react/renderer/core/ShadowNodeFamily.h>
+#include <react/renderer/core/StateUpdate.h>
 
 namespace facebook::react {
 
+class RootShadowNode;
+
 /*
  * An abstract interface of State.
  * State is used to control and continuously advance a single vision of some
@@ -67,11 +72,23 @@ class State {
   virtual folly::dynamic getDynamic() const = 0;
   virtual MapBuffer getMapBuffer() const = 0;
   virtual void updateState(folly::dynamic&& data) const = 0;
+
+  /*
+   * Creates new state data from the previous data and `data` (as returned by
+   * `getDynamic`), without dispatching an update.
+   */
+  virtual StateData::Shared createData(
+      const StateData::Shared& previousData,
+      const folly::dynamic& data) const = 0;
 #endif
 
  protected:
   friend class ShadowNodeFamily;
   friend class UIManager;
+  friend class RendererRecorder;
+  friend std::shared_ptr<RootShadowNode> applyStateUpdates(
+      const RootShadowNode& oldRootShadowNode,
+      const std::vector<StateUpdate>& stateUpdates);
 
   /*
    * Returns a shared pointer to data.
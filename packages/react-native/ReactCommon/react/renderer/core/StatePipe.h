@@ -8,6 +8,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <react/renderer/core/StateUpdate.h>
 
@@ -15,4 +16,11 @@ namespace facebook::react {
 
 using StatePipe = std::function<void(const StateUpdate& stateUpdate)>;
 
+/*
+ * Receives all state updates accumulated during one event beat at once, so
+ * they can be committed together.
+ */
+using StateBatchPipe =
+    std::function<void(const std::vector<StateUpdate>& stateUpdates)>;
+
 } // namespace facebook::react
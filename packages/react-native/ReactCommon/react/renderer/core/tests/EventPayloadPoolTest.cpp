@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/EventPayloadPool.h>
+#include <react/renderer/core/ValueFactoryEventPayload.h>
+
+namespace facebook::react {
+
+namespace {
+
+struct LargePayload {
+  std::array<char, EventPayloadPool::kMaxPooledSize + 1> data{};
+};
+
+} // namespace
+
+TEST(EventPayloadPoolTest, reusesReleasedPayloadMemory) {
+  auto payload = makeSharedEventPayload<ValueFactoryEventPayload>(
+      [](jsi::Runtime& runtime) { return jsi::Value::null(); });
+  const void* address = payload.get();
+  payload.reset();
+
+  auto freeBlockCount = EventPayloadPool::getFreeBlockCount();
+  EXPECT_GT(freeBlockCount, 0);
+
+  auto otherPayload = makeSharedEventPayload<ValueFactoryEventPayload>(
+      [](jsi::Runtime& runtime) { return jsi::Value::undefined(); });
+  EXPECT_EQ(otherPayload.get(), address);
+  EXPECT_EQ(EventPayloadPool::getFreeBlockCount(), freeBlockCount - 1);
+}
+
+TEST(EventPayloadPoolTest, doesNotPoolLargePayloads) {
+  auto freeBlockCount = EventPayloadPool::getFreeBlockCount();
+  auto payload = makeSharedEventPayload<LargePayload>();
+  payload.reset();
+  EXPECT_EQ(EventPayloadPool::getFreeBlockCount(), freeBlockCount);
+}
+
+TEST(EventPayloadPoolTest, releasesPayloadsOnOtherThreads) {
+  constexpr int kPayloadCount = 1000;
+
+  for (int round = 0; round < 4; round++) {
+    auto payloads = std::vector<std::shared_ptr<int>>{};
+    for (int i = 0; i < kPayloadCount; i++) {
+      payloads.push_back(makeSharedEventPayload<int>(i));
+    }
+    for (int i = 0; i < kPayloadCount; i++) {
+      EXPECT_EQ(*payloads[i], i);
+    }
+
+    // Payloads are typically created on the UI thread and released on the
+    // JavaScript thread.
+    std::thread([payloads = std::move(payloads)]() mutable {
+      payloads.clear();
+    }).join();
+  }
+
+  // The number of retained blocks is bounded.
+  EXPECT_LT(EventPayloadPool::getFreeBlockCount(), kPayloadCount);
+}
+
+TEST(EventPayloadPoolTest, supportsConcurrentProducersAndConsumers) {
+  constexpr int kThreadCount = 4;
+  constexpr int kPayloadCount = 10000;
+
+  auto threads = std::vector<std::thread>{};
+  for (int t = 0; t < kThreadCount; t++) {
+    threads.emplace_back([t]() {
+      auto payloads = std::vector<std::shared_ptr<int>>{};
+      for (int i = 0; i < kPayloadCount; i++) {
+        payloads.push_back(makeSharedEventPayload<int>(t * kPayloadCount + i));
+        if (payloads.size() == 16) {
+          for (size_t j = 0; j < payloads.size(); j++) {
+            EXPECT_EQ(
+                *payloads[j],
+                t * kPayloadCount + i - static_cast<int>(payloads.size()) +
+                    1 + static_cast<int>(j));
+          }
+          payloads.clear();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace facebook::react
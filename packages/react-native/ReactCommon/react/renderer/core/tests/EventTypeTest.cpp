@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/EventEmitter.h>
+#include <react/renderer/core/EventType.h>
+
+namespace facebook::react {
+
+TEST(EventTypeTest, internsNames) {
+  auto name = std::string{"customEvent"};
+  auto eventType = EventType{name};
+
+  EXPECT_EQ(eventType, EventType{"customEvent"});
+  EXPECT_EQ(eventType.getId(), EventType{std::string_view{name}}.getId());
+  EXPECT_EQ(&eventType.getName(), &EventType{"customEvent"}.getName());
+  EXPECT_EQ(eventType.getName(), "customEvent");
+  EXPECT_NE(eventType, EventType{"otherCustomEvent"});
+}
+
+TEST(EventTypeTest, normalizesNames) {
+  EXPECT_EQ(EventType{"scroll"}.normalized().getName(), "topScroll");
+  EXPECT_EQ(EventType{"onScroll"}.normalized(), EventType{"topScroll"});
+  EXPECT_EQ(EventType{"topScroll"}.normalized(), EventType{"topScroll"});
+  EXPECT_EQ(
+      EventType{"scroll"}.normalized(), EventType{"onScroll"}.normalized());
+
+  EXPECT_EQ(EventEmitter::normalizeEventType("layout"), "topLayout");
+  EXPECT_EQ(EventEmitter::normalizeEventType("onLayout"), "topLayout");
+  EXPECT_EQ(EventEmitter::normalizeEventType("topLayout"), "topLayout");
+}
+
+TEST(EventTypeTest, internsConcurrently) {
+  constexpr int kThreadCount = 8;
+  constexpr int kNameCount = 256;
+
+  auto ids = std::vector<std::vector<EventType::Id>>(kThreadCount);
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < kThreadCount; i++) {
+    threads.emplace_back([&ids, i]() {
+      for (int j = 0; j < kNameCount; j++) {
+        auto eventType =
+            EventType{"concurrentEvent" + std::to_string(j)}.normalized();
+        ids[i].push_back(eventType.getId());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int i = 1; i < kThreadCount; i++) {
+    EXPECT_EQ(ids[i], ids[0]);
+  }
+  EXPECT_EQ(
+      EventType{"concurrentEvent7"}.normalized().getName(),
+      "topConcurrentEvent7");
+}
+
+} // namespace facebook::react
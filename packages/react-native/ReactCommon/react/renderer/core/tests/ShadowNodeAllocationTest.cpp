@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/ShadowNodeAllocation.h>
+#include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/utils/CoreFeatures.h>
+
+#include "TestComponent.h"
+
+namespace facebook::react {
+
+class ShadowNodeAllocationTest : public ::testing::Test {
+ protected:
+  ShadowNodeAllocationTest()
+      : componentDescriptor_(
+            TestComponentDescriptor({std::shared_ptr<const EventDispatcher>()})),
+        family_(componentDescriptor_.createFamily(ShadowNodeFamilyFragment{
+            /* .tag = */ 11,
+            /* .surfaceId = */ 1,
+            /* .instanceHandle = */ nullptr,
+        })) {
+    CoreFeatures::enableShadowNodeAllocationPool = true;
+  }
+
+  ~ShadowNodeAllocationTest() override {
+    CoreFeatures::enableShadowNodeAllocationPool = false;
+  }
+
+  ShadowNode::Shared createNode() {
+    return componentDescriptor_.createShadowNode(
+        ShadowNodeFragment{
+            /* .props = */ std::make_shared<const TestProps>(),
+            /* .children = */ ShadowNode::emptySharedShadowNodeSharedList(),
+        },
+        family_);
+  }
+
+  TestComponentDescriptor componentDescriptor_;
+  ShadowNodeFamily::Shared family_;
+};
+
+TEST_F(ShadowNodeAllocationTest, reusesReleasedShadowNodeMemory) {
+  auto node = createNode();
+  auto clone = node->clone({});
+  const void* address = clone.get();
+  clone.reset();
+
+  auto freeBlockCount = ShadowNodeAllocationPool::getThreadFreeBlockCount();
+  EXPECT_GT(freeBlockCount, 0);
+
+  auto otherClone = node->clone({});
+  EXPECT_EQ(otherClone.get(), address);
+  EXPECT_EQ(
+      ShadowNodeAllocationPool::getThreadFreeBlockCount(), freeBlockCount - 1);
+}
+
+TEST_F(ShadowNodeAllocationTest, countsAllocations) {
+  auto node = createNode();
+  auto countBefore = getThreadShadowNodeAllocationCount();
+
+  auto children = makeSharedChildrenList<ShadowNode::ListOfShared>(
+      ShadowNode::ListOfShared{node});
+  auto clone = node->clone({});
+
+  auto countAfter = getThreadShadowNodeAllocationCount();
+  EXPECT_EQ(countAfter.shadowNodes - countBefore.shadowNodes, 1);
+  EXPECT_EQ(countAfter.childrenLists - countBefore.childrenLists, 1);
+
+  // Counts are per thread.
+  std::thread([]() {
+    EXPECT_EQ(getThreadShadowNodeAllocationCount().shadowNodes, 0);
+  }).join();
+}
+
+TEST_F(ShadowNodeAllocationTest, releasesNodesOnOtherThreads) {
+  auto node = createNode();
+  auto clone = node->clone({});
+
+  // Revisions are often released on the UI thread after mounting; the block
+  // is freed there (that thread never allocated, so it doesn't pool it).
+  std::thread([clone = std::move(clone)]() mutable {
+    clone.reset();
+    EXPECT_EQ(ShadowNodeAllocationPool::getThreadFreeBlockCount(), 0);
+  }).join();
+
+  CoreFeatures::enableShadowNodeAllocationPool = false;
+  auto otherClone = node->clone({});
+  EXPECT_NE(otherClone, nullptr);
+}
+
+} // namespace facebook::react
@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <exception>
 
 #include <gtest/gtest.h>
@@ -77,3 +78,81 @@ TEST(ShadowNodeFamilyTest, sealObjectCorrectly) {
   EXPECT_EQ(&ancestors2[0].first.get(), shadowNodeA.get());
   EXPECT_EQ(&ancestors2[1].first.get(), shadowNodeAA.get());
 }
+
+TEST(ShadowNodeFamilyTest, getAncestorsInDifferentRevisions) {
+  /*
+   * The structure:
+   * <A>
+   *  <AA/>
+   *  <AB/>
+   *  <AC>
+   *    <ACA/>
+   *  </AC>
+   * </A>
+   */
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  auto builder = ComponentBuilder{componentDescriptorRegistry};
+
+  auto shadowNodeAA = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeAC = std::shared_ptr<ViewShadowNode>{};
+  auto shadowNodeACA = std::shared_ptr<ViewShadowNode>{};
+
+  // clang-format off
+  auto elementA =
+      Element<ViewShadowNode>()
+        .tag(1)
+        .children({
+          Element<ViewShadowNode>()
+            .tag(2)
+            .reference(shadowNodeAA),
+          Element<ViewShadowNode>()
+            .tag(3),
+          Element<ViewShadowNode>()
+            .tag(4)
+            .reference(shadowNodeAC)
+            .children({
+              Element<ViewShadowNode>()
+                .tag(5)
+                .reference(shadowNodeACA)
+            })
+        });
+  // clang-format on
+
+  auto shadowNodeA = builder.build(elementA);
+
+  auto ancestors1 = shadowNodeACA->getFamily().getAncestors(*shadowNodeA);
+  EXPECT_EQ(ancestors1.size(), 2);
+  EXPECT_EQ(ancestors1[0].second, 2);
+  EXPECT_EQ(ancestors1[1].second, 0);
+
+  // A new revision of `A` with the children in reverse order.
+  auto reversedChildren = shadowNodeA->getChildren();
+  std::reverse(reversedChildren.begin(), reversedChildren.end());
+  auto newShadowNodeA = shadowNodeA->clone(
+      {.children =
+           std::make_shared<ShadowNode::ListOfShared>(reversedChildren)});
+
+  auto ancestors2 = shadowNodeACA->getFamily().getAncestors(*newShadowNodeA);
+  EXPECT_EQ(ancestors2.size(), 2);
+  EXPECT_EQ(&ancestors2[0].first.get(), newShadowNodeA.get());
+  EXPECT_EQ(ancestors2[0].second, 0);
+  EXPECT_EQ(ancestors2[1].second, 0);
+
+  // The old revision still resolves to the old positions.
+  auto ancestors3 = shadowNodeAA->getFamily().getAncestors(*shadowNodeA);
+  EXPECT_EQ(ancestors3.size(), 1);
+  EXPECT_EQ(&ancestors3[0].first.get(), shadowNodeA.get());
+  EXPECT_EQ(ancestors3[0].second, 0);
+
+  auto ancestors4 = shadowNodeAC->getFamily().getAncestors(*shadowNodeA);
+  EXPECT_EQ(ancestors4.size(), 1);
+  EXPECT_EQ(ancestors4[0].second, 2);
+}
@@ -12,6 +12,7 @@
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFragment.h>
 
 #include "TestComponent.h"
 
@@ -350,6 +351,88 @@ TEST_P(ShadowNodeTest, testCloneTree) {
       ShadowNodeTraits::Trait::ClonedByNativeStateUpdate));
 }
 
+TEST_P(ShadowNodeTest, testCloneTreeWithMultipleFamilies) {
+  auto newTraits = ShadowNodeTraits();
+  newTraits.set(ShadowNodeTraits::Trait::ClonedByNativeStateUpdate);
+  auto cloneCount = 0;
+  auto callback = [&](const ShadowNode& oldShadowNode,
+                      const ShadowNodeFragment& fragment) {
+    cloneCount++;
+    return oldShadowNode.clone(
+        {.children = fragment.children, .traits = newTraits});
+  };
+
+  auto rootNode = nodeA_->cloneTree(
+      {{&nodeAA_->getFamily(), callback},
+       {&nodeABA_->getFamily(), callback},
+       {&nodeABB_->getFamily(), callback}},
+      newTraits);
+
+  // Only the targets invoke the callback, the shared ancestor `AB` is cloned
+  // once.
+  EXPECT_EQ(cloneCount, 3);
+
+  EXPECT_TRUE(rootNode->getTraits().check(
+      ShadowNodeTraits::Trait::ClonedByNativeStateUpdate));
+  EXPECT_EQ(rootNode->getChildren().size(), 3);
+
+  const auto& nodeAA = rootNode->getChildren()[0];
+  EXPECT_NE(nodeAA, nodeAA_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*nodeAA, *nodeAA_));
+
+  const auto& nodeAB = rootNode->getChildren()[1];
+  EXPECT_NE(nodeAB, nodeAB_);
+  EXPECT_TRUE(nodeAB->getTraits().check(
+      ShadowNodeTraits::Trait::ClonedByNativeStateUpdate));
+  EXPECT_NE(nodeAB->getChildren()[0], nodeABA_);
+  EXPECT_NE(nodeAB->getChildren()[1], nodeABB_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*nodeAB->getChildren()[0], *nodeABA_));
+  EXPECT_TRUE(ShadowNode::sameFamily(*nodeAB->getChildren()[1], *nodeABB_));
+
+  const auto& nodeAC = rootNode->getChildren()[2];
+  EXPECT_TRUE(ShadowNode::sameFamily(*nodeAC, *nodeAC_));
+  EXPECT_FALSE(nodeAC->getTraits().check(
+      ShadowNodeTraits::Trait::ClonedByNativeStateUpdate));
+}
+
+TEST_P(ShadowNodeTest, testCloneTreeWithNestedFamilies) {
+  auto newABA = ShadowNode::Shared{};
+  auto rootNode = nodeA_->cloneTree(
+      {{&nodeAB_->getFamily(),
+        [&](const ShadowNode& oldShadowNode,
+            const ShadowNodeFragment& fragment) {
+          // The updated child is handed over to the ancestor's callback.
+          EXPECT_NE(fragment.children, nullptr);
+          EXPECT_EQ(fragment.children->at(0), newABA);
+          return oldShadowNode.clone({.children = fragment.children});
+        }},
+       {&nodeABA_->getFamily(),
+        [&](const ShadowNode& oldShadowNode,
+            const ShadowNodeFragment& /*fragment*/) {
+          auto newShadowNode = oldShadowNode.clone({});
+          newABA = newShadowNode;
+          return newShadowNode;
+        }}});
+
+  EXPECT_EQ(rootNode->getChildren()[1]->getChildren()[0], newABA);
+  EXPECT_TRUE(ShadowNode::sameFamily(
+      *rootNode->getChildren()[1]->getChildren()[1], *nodeABB_));
+}
+
+TEST_P(ShadowNodeTest, testCloneTreeWithoutChanges) {
+  auto keepNode = [](const ShadowNode& /*oldShadowNode*/,
+                     const ShadowNodeFragment& /*fragment*/) {
+    return ShadowNode::Unshared{nullptr};
+  };
+
+  // Declined by the callback.
+  EXPECT_EQ(
+      nodeA_->cloneTree({{&nodeABA_->getFamily(), keepNode}}), nullptr);
+
+  // Not part of the tree.
+  EXPECT_EQ(nodeA_->cloneTree({{&nodeZ_->getFamily(), keepNode}}), nullptr);
+}
+
 TEST_P(ShadowNodeTest, handleRuntimeReferenceTransferOnClone) {
   auto nodeABRev1 = nodeAB_->clone({});
   auto wrappedShadowNode = std::make_shared<ShadowNodeWrapper>(nodeABRev1);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/EventEmitter.h>
+#include <react/renderer/core/EventTarget.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Models several surfaces committing and flushing events at the same time.
+ * Every pair of benchmark threads works on the emitters of one surface: the
+ * even thread toggles mount state the way `updateMountedFlag` does during a
+ * commit, the odd one reads event targets the way events are dispatched and
+ * flushed.
+ * The `Legacy` variants wrap both in the former process-wide
+ * `EventEmitter::DispatchMutex()` for comparison.
+ */
+
+constexpr size_t kEmittersPerSurface = 256;
+
+struct Surface {
+  std::vector<std::shared_ptr<EventTarget>> eventTargets;
+  std::vector<std::shared_ptr<EventEmitter>> eventEmitters;
+};
+
+static Surface createSurface(SurfaceId surfaceId) {
+  auto surface = Surface{};
+  for (size_t i = 0; i < kEmittersPerSurface; i++) {
+    auto eventTarget = std::make_shared<EventTarget>(nullptr, surfaceId);
+    auto eventEmitter =
+        std::make_shared<EventEmitter>(eventTarget, EventDispatcher::Weak{});
+    // Keeps the enable counter above zero so toggling never releases the
+    // event target.
+    eventEmitter->setEnabled(true);
+    surface.eventTargets.push_back(std::move(eventTarget));
+    surface.eventEmitters.push_back(std::move(eventEmitter));
+  }
+  return surface;
+}
+
+static const Surface& surfaceForThread(const benchmark::State& state) {
+  // Function-local statics are initialized once, even when threads race.
+  static const auto surfaces = []() {
+    auto surfaces = std::vector<Surface>{};
+    for (SurfaceId surfaceId = 0; surfaceId < 8; surfaceId++) {
+      surfaces.push_back(createSurface(surfaceId));
+    }
+    return surfaces;
+  }();
+  return surfaces[(state.thread_index() / 2) % surfaces.size()];
+}
+
+static void commit(const Surface& surface, bool legacy) {
+  auto toggle = [&]() {
+    for (const auto& eventEmitter : surface.eventEmitters) {
+      eventEmitter->setEnabled(true);
+      eventEmitter->setEnabled(false);
+    }
+  };
+
+  if (legacy) {
+    std::scoped_lock lock(EventEmitter::DispatchMutex());
+    toggle();
+  } else {
+    toggle();
+  }
+}
+
+static void flushEvents(const Surface& surface, bool legacy) {
+  auto read = [&]() {
+    for (const auto& eventEmitter : surface.eventEmitters) {
+      auto eventTarget = eventEmitter->getEventTarget();
+      benchmark::DoNotOptimize(eventTarget);
+    }
+  };
+
+  if (legacy) {
+    std::scoped_lock lock(EventEmitter::DispatchMutex());
+    read();
+  } else {
+    read();
+  }
+}
+
+static void runContention(benchmark::State& state, bool legacy) {
+  const auto& surface = surfaceForThread(state);
+  bool isCommitting = state.thread_index() % 2 == 0;
+
+  for (auto _ : state) {
+    if (isCommitting) {
+      commit(surface, legacy);
+    } else {
+      flushEvents(surface, legacy);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kEmittersPerSurface);
+}
+
+static void concurrentCommitsAndEventFlushes(benchmark::State& state) {
+  runContention(state, false);
+}
+BENCHMARK(concurrentCommitsAndEventFlushes)->ThreadRange(1, 8)->UseRealTime();
+
+static void concurrentCommitsAndEventFlushesLegacy(benchmark::State& state) {
+  runContention(state, true);
+}
+BENCHMARK(concurrentCommitsAndEventFlushesLegacy)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
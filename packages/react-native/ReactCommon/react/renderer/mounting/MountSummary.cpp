@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MountSummary.h"
+
+namespace facebook::react {
+
+void MountSummary::addMutations(const ShadowViewMutationList& mutations) {
+  numberOfTransactions++;
+  numberOfMutations += mutations.size();
+
+  if (!hasAllChangedFamilies) {
+    return;
+  }
+
+  auto hasFamilies =
+      changedFamilies.size() + mutations.size() <= kMaxChangedFamilies;
+  for (auto it = mutations.begin(); hasFamilies && it != mutations.end();
+       it++) {
+    auto isRemoval = it->type == ShadowViewMutation::Delete ||
+        it->type == ShadowViewMutation::Remove;
+    const auto* family = isRemoval ? it->oldChildShadowView.family
+                                   : it->newChildShadowView.family;
+    hasFamilies = family != nullptr;
+    changedFamilies.push_back(family);
+  }
+
+  if (!hasFamilies) {
+    changedFamilies.clear();
+    changedFamilies.shrink_to_fit();
+    hasAllChangedFamilies = false;
+  }
+}
+
+} // namespace facebook::react
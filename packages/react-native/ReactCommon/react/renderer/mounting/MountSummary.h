@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/ShadowTreeRevision.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+namespace facebook::react {
+
+/*
+ * What was mounted in a surface since the previous summary was taken from its
+ * `MountingCoordinator`.
+ */
+struct MountSummary {
+  /*
+   * Maximum number of mutations whose families are tracked between
+   * summaries.
+   */
+  static constexpr size_t kMaxChangedFamilies = 1024;
+
+  SurfaceId surfaceId{};
+
+  // The mounted revision, or null if the surface was stopped.
+  RootShadowNode::Shared rootShadowNode;
+  ShadowTreeRevision::Number revisionNumber{0};
+
+  // Families of the nodes whose views were created, deleted, updated,
+  // inserted or removed, sorted and without duplicates. Flattened nodes don't
+  // have views, so they only show up through the views they affect. If there
+  // were more than `kMaxChangedFamilies` mutations (or mutations of views
+  // that don't identify their family), the list is empty and
+  // `hasAllChangedFamilies` is `false`: consumers should then assume that
+  // anything could have changed.
+  std::vector<const ShadowNodeFamily*> changedFamilies;
+  bool hasAllChangedFamilies{true};
+
+  size_t numberOfTransactions{0};
+  size_t numberOfMutations{0};
+
+  // Telemetry of the mounted transactions caused by input events.
+  std::vector<TransactionTelemetry> eventTransactionTelemetries;
+
+  /*
+   * Accumulates the changes made by `mutations` (of a transaction mounted
+   * after the ones already added). `changedFamilies` is only sorted by
+   * `MountingCoordinator::takeMountSummary`.
+   */
+  void addMutations(const ShadowViewMutationList& mutations);
+};
+
+} // namespace facebook::react
@@ -13,7 +13,9 @@
 #include <sstream>
 #endif
 
+#include <algorithm>
 #include <condition_variable>
+#include <utility>
 
 #include <cxxreact/SystraceSection.h>
 #include <react/debug/react_native_assert.h>
@@ -43,6 +45,17 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
         !lastRevision_.has_value() || revision.number != lastRevision_->number);
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
+      // The events that caused the revision being replaced now wait for
+      // this one to be mounted.
+      if (lastRevision_.has_value()) {
+        const auto& supersededTelemetry = lastRevision_->telemetry;
+        for (auto causalityId :
+             supersededTelemetry.getSupersededEventCausalityIds()) {
+          revision.telemetry.addSupersededEventCausalityId(causalityId);
+        }
+        revision.telemetry.addSupersededEventCausalityId(
+            supersededTelemetry.getEventCausalityId());
+      }
       lastRevision_ = std::move(revision);
     }
   }
@@ -82,7 +95,7 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
     bool willPerformAsynchronously) const {
   SystraceSection section("MountingCoordinator::pullTransaction");
 
-  std::scoped_lock lock(mutex_);
+  std::unique_lock lock(mutex_);
 
   auto transaction = std::optional<MountingTransaction>{};
 
@@ -181,12 +194,30 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
   }
 #endif
 
+  if (transaction.has_value() &&
+      transaction->getTelemetry().hasEventCausality()) {
+    if (eventTransactionTelemetries_.size() >=
+        kMaxPendingEventTransactionTelemetries) {
+      eventTransactionTelemetries_.erase(eventTransactionTelemetries_.begin());
+    }
+    eventTransactionTelemetries_.push_back(transaction->getTelemetry());
+  }
+
   if (lastRevision_.has_value()) {
     baseRevision_ = std::move(*lastRevision_);
     lastRevision_.reset();
 
     hasPendingTransactionsOverride_ = willPerformAsynchronously;
   }
+
+  if (transaction.has_value()) {
+    // Summaries taken from now on wait for the changes of the transaction,
+    // which are summarized without blocking the committing threads.
+    std::scoped_lock mountSummaryLock(mountSummaryMutex_);
+    lock.unlock();
+    mountSummary_.addMutations(transaction->getMutations());
+  }
+
   return transaction;
 }
 
@@ -209,6 +240,34 @@ ShadowTreeRevision MountingCoordinator::getBaseRevision() const {
   return baseRevision_;
 }
 
+std::optional<ShadowTreeRevision> MountingCoordinator::getPendingRevision()
+    const {
+  std::scoped_lock lock(mutex_);
+  return lastRevision_;
+}
+
+MountSummary MountingCoordinator::takeMountSummary() const {
+  auto summary = MountSummary{};
+
+  {
+    std::scoped_lock lock(mutex_, mountSummaryMutex_);
+    summary = std::exchange(mountSummary_, {});
+    summary.surfaceId = surfaceId_;
+    summary.rootShadowNode = baseRevision_.rootShadowNode;
+    summary.revisionNumber = baseRevision_.number;
+    summary.eventTransactionTelemetries =
+        std::exchange(eventTransactionTelemetries_, {});
+  }
+
+  auto& changedFamilies = summary.changedFamilies;
+  std::sort(changedFamilies.begin(), changedFamilies.end());
+  changedFamilies.erase(
+      std::unique(changedFamilies.begin(), changedFamilies.end()),
+      changedFamilies.end());
+
+  return summary;
+}
+
 void MountingCoordinator::setMountingOverrideDelegate(
     std::weak_ptr<const MountingOverrideDelegate> delegate) const {
   std::scoped_lock lock(mutex_);
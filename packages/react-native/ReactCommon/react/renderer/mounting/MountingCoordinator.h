@@ -10,9 +10,11 @@
 #include <chrono>
 #include <condition_variable>
 #include <optional>
+#include <vector>
 
 #include <react/renderer/debug/flags.h>
 #include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountSummary.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/MountingTransaction.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
@@ -101,6 +103,25 @@ class MountingCoordinator final {
 
   ShadowTreeRevision getBaseRevision() const;
 
+  /*
+   * Returns the revision that will be mounted by the next transaction, if
+   * there is one.
+   */
+  std::optional<ShadowTreeRevision> getPendingRevision() const;
+
+  static constexpr size_t kMaxPendingEventTransactionTelemetries = 16;
+
+  /*
+   * Returns a summary of the transactions pulled since the previous call
+   * (including the telemetry of the ones caused by input events, see
+   * `EventCausality.h`; only the latest
+   * `kMaxPendingEventTransactionTelemetries` are kept) along with the mounted
+   * revision, so consumers of mount notifications don't need to look the
+   * revision up or compare trees to know what changed.
+   * Can be called from any thread.
+   */
+  MountSummary takeMountSummary() const;
+
   /*
    * Methods from this section are meant to be used by
    * `MountingOverrideDelegate` only.
@@ -143,6 +164,14 @@ class MountingCoordinator final {
   mutable std::vector<std::weak_ptr<const MountingOverrideDelegate>>
       mountingOverrideDelegates_;
 
+  mutable std::vector<TransactionTelemetry>
+      eventTransactionTelemetries_; // Protected by `mutex_`.
+
+  // Changes of the transactions pulled since the last call to
+  // `takeMountSummary`. Locked after `mutex_` when both are needed.
+  mutable std::mutex mountSummaryMutex_;
+  mutable MountSummary mountSummary_; // Protected by `mountSummaryMutex_`.
+
   TelemetryController telemetryController_;
 
 #ifdef RN_SHADOW_TREE_INTROSPECTION
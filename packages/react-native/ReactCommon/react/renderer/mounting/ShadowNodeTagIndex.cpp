@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowNodeTagIndex.h"
+
+namespace facebook::react {
+
+void ShadowNodeTagIndex::update(
+    const ShadowNode::ListOfShared& oldChildren,
+    const ShadowNode::ListOfShared& newChildren) {
+  apply(collectMountedFlagChanges(oldChildren, newChildren));
+}
+
+void ShadowNodeTagIndex::apply(const MountedFlagChanges& changes) {
+  // Reordered nodes are both removed and inserted; applying removals first
+  // keeps them in the index.
+  for (auto tag : changes.removedTags) {
+    nodes_.erase(tag);
+  }
+
+  for (const auto* shadowNode : changes.mountedNodes) {
+    nodes_[(*shadowNode)->getTag()] = *shadowNode;
+  }
+}
+
+ShadowNode::Shared ShadowNodeTagIndex::find(Tag tag) const {
+  auto iterator = nodes_.find(tag);
+  return iterator != nodes_.end() ? iterator->second : nullptr;
+}
+
+size_t ShadowNodeTagIndex::size() const {
+  return nodes_.size();
+}
+
+} // namespace facebook::react
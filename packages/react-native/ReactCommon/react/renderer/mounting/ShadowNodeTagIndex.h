@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <unordered_map>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/updateMountedFlag.h>
+
+namespace facebook::react {
+
+/*
+ * Maps tags to the shadow nodes of one committed shadow tree (excluding the
+ * root node itself), so that the newest clone of a node can be found without
+ * walking the tree.
+ * The index is maintained incrementally from the same changes that update the
+ * `mounted` flag, so it only visits subtrees that differ between revisions.
+ * Not thread-safe; `ShadowTree` guards it with `tagIndexMutex_` (updated
+ * under an exclusive lock while committing, read under a shared lock).
+ */
+class ShadowNodeTagIndex final {
+ public:
+  /*
+   * Updates the index from the tree with `oldChildren` to the tree with
+   * `newChildren` (children of two revisions of the same root node).
+   */
+  void update(
+      const ShadowNode::ListOfShared& oldChildren,
+      const ShadowNode::ListOfShared& newChildren);
+
+  /*
+   * Updates the index with changes collected between two revisions of the
+   * indexed tree.
+   */
+  void apply(const MountedFlagChanges& changes);
+
+  /*
+   * Returns the indexed node with the given tag, `nullptr` if there is none.
+   */
+  ShadowNode::Shared find(Tag tag) const;
+
+  size_t size() const;
+
+ private:
+  std::unordered_map<Tag, ShadowNode::Shared> nodes_;
+};
+
+} // namespace facebook::react
@@ -12,11 +12,15 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/core/EventQueueProcessor.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutPrimitives.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <react/utils/OnScopeExit.h>
+#include <react/utils/RendererPhase.h>
 #include "updateMountedFlag.h"
 
 #include "ShadowTreeDelegate.h"
@@ -26,6 +30,11 @@ namespace facebook::react {
 using CommitStatus = ShadowTree::CommitStatus;
 using CommitMode = ShadowTree::CommitMode;
 
+// Allocation count of the thread when it last committed successfully.
+// What's allocated in between (mostly the clones built by React for the next
+// commit) is attributed to the next commit on the same thread.
+static thread_local ShadowNodeAllocationCount lastCommitAllocationCount{};
+
 // --- State Alignment Mechanism algorithm ---
 // Note: Ideally, we don't have to const_cast but our use of constness in
 // C++ is overly restrictive. We do const_cast here but the only place where
@@ -176,9 +185,10 @@ static ShadowNode::Unshared progressState(const ShadowNode& shadowNode) {
 
   return shadowNode.clone({
       ShadowNodeFragment::propsPlaceholder(),
-      areChildrenChanged ? std::make_shared<const ShadowNode::ListOfShared>(
-                               std::move(newChildren))
-                         : ShadowNodeFragment::childrenPlaceholder(),
+      areChildrenChanged
+          ? makeSharedChildrenList<ShadowNode::ListOfShared>(
+                std::move(newChildren))
+          : ShadowNodeFragment::childrenPlaceholder(),
       isStateChanged ? newState : ShadowNodeFragment::statePlaceholder(),
   });
 }
@@ -263,9 +273,10 @@ static ShadowNode::Unshared progressState(
 
   return shadowNode.clone({
       ShadowNodeFragment::propsPlaceholder(),
-      areChildrenChanged ? std::make_shared<const ShadowNode::ListOfShared>(
-                               std::move(newChildren))
-                         : ShadowNodeFragment::childrenPlaceholder(),
+      areChildrenChanged
+          ? makeSharedChildrenList<ShadowNode::ListOfShared>(
+                std::move(newChildren))
+          : ShadowNodeFragment::childrenPlaceholder(),
       isStateChanged ? newState : ShadowNodeFragment::statePlaceholder(),
   });
 }
@@ -298,13 +309,13 @@ ShadowTree::ShadowTree(
           },
           family));
 
-  currentRevision_ = ShadowTreeRevision{
+  auto revision = ShadowTreeRevision{
       rootShadowNode, INITIAL_REVISION, TransactionTelemetry{}};
 
-  lastRevisionNumberWithNewState_ = currentRevision_.number;
+  publishRevision(std::make_shared<const PublishedRevision>(
+      PublishedRevision{revision, revision.number}));
 
-  mountingCoordinator_ =
-      std::make_shared<const MountingCoordinator>(currentRevision_);
+  mountingCoordinator_ = std::make_shared<const MountingCoordinator>(revision);
 }
 
 ShadowTree::~ShadowTree() {
@@ -319,13 +330,13 @@ void ShadowTree::setCommitMode(CommitMode commitMode) const {
   auto revision = ShadowTreeRevision{};
 
   {
-    std::unique_lock lock(commitMutex_);
+    std::scoped_lock lock(commitMutex_);
     if (commitMode_ == commitMode) {
       return;
     }
 
     commitMode_ = commitMode;
-    revision = currentRevision_;
+    revision = loadPublishedRevision()->revision;
   }
 
   // initial revision never contains any commits so mounting it here is
@@ -336,7 +347,6 @@ void ShadowTree::setCommitMode(CommitMode commitMode) const {
 }
 
 CommitMode ShadowTree::getCommitMode() const {
-  std::shared_lock lock(commitMutex_);
   return commitMode_;
 }
 
@@ -373,18 +383,19 @@ CommitStatus ShadowTree::tryCommit(
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
 
-  CommitMode commitMode;
-  auto oldRevision = ShadowTreeRevision{};
+  // Cancelled and failed attempts return before `didCommit`.
+  OnScopeExit resetRendererPhase(
+      []() { setCurrentRendererPhase(RendererPhase::None); });
+
+  auto commitMode = commitMode_.load();
   auto newRevision = ShadowTreeRevision{};
-  ShadowTreeRevision::Number lastRevisionNumberWithNewState;
 
-  {
-    // Reading `currentRevision_` in shared manner.
-    std::shared_lock lock(commitMutex_);
-    commitMode = commitMode_;
-    oldRevision = currentRevision_;
-    lastRevisionNumberWithNewState = lastRevisionNumberWithNewState_;
-  }
+  // The revision and its state marker are published together, so they are
+  // read consistently without taking `commitMutex_`.
+  auto oldPublishedRevision = loadPublishedRevision();
+  const auto& oldRevision = oldPublishedRevision->revision;
+  auto lastRevisionNumberWithNewState =
+      oldPublishedRevision->lastRevisionNumberWithNewState;
 
   const auto& oldRootShadowNode = oldRevision.rootShadowNode;
   auto newRootShadowNode = transaction(*oldRevision.rootShadowNode);
@@ -394,7 +405,12 @@ CommitStatus ShadowTree::tryCommit(
     return CommitStatus::Cancelled;
   }
 
+  telemetry.setEventStartTime(
+      EventQueueProcessor::getOldestUncommittedEventTime());
+  telemetry.setEventCausalityId(getCurrentEventCausalityId());
+
   if (commitOptions.enableStateReconciliation) {
+    telemetry.willReconcileState();
     if (ReactNativeFeatureFlags::useStateAlignmentMechanism()) {
       progressStateIfNecessary(*newRootShadowNode, *oldRootShadowNode);
     } else {
@@ -405,11 +421,14 @@ CommitStatus ShadowTree::tryCommit(
             std::static_pointer_cast<RootShadowNode>(updatedNewRootShadowNode);
       }
     }
+    telemetry.didReconcileState();
   }
 
   // Run commit hooks.
+  telemetry.willRunCommitHooks();
   newRootShadowNode = delegate_.shadowTreeWillCommit(
       *this, oldRootShadowNode, newRootShadowNode);
+  telemetry.didRunCommitHooks();
 
   if (!newRootShadowNode ||
       (commitOptions.shouldYield && commitOptions.shouldYield())) {
@@ -426,41 +445,72 @@ CommitStatus ShadowTree::tryCommit(
   telemetry.unsetAsThreadLocal();
   telemetry.didLayout(static_cast<int>(affectedLayoutableNodes.size()));
 
+  auto isGranularStateReconciliationEnabled = ReactNativeFeatureFlags::
+      enableGranularShadowTreeStateReconciliation();
+
+  if (!isGranularStateReconciliationEnabled &&
+      loadPublishedRevision()->revision.number != oldRevision.number) {
+    // Another commit already won; retry without waiting for the lock.
+    return CommitStatus::Failed;
+  }
+
+  // Comparing the trees doesn't mutate them, so it happens before taking the
+  // lock. If another commit lands in between, the changes are collected
+  // again against the new current revision below.
+  auto mountedFlagChanges = collectMountedFlagChanges(
+      oldRootShadowNode->getChildren(), newRootShadowNode->getChildren());
+
   {
-    // Updating `currentRevision_` in unique manner if it hasn't changed.
-    std::unique_lock lock(commitMutex_);
+    // Publishing the new revision if the current one hasn't changed.
+    std::scoped_lock lock(commitMutex_);
 
     if (commitOptions.shouldYield && commitOptions.shouldYield()) {
       return CommitStatus::Cancelled;
     }
 
-    if (ReactNativeFeatureFlags::
-            enableGranularShadowTreeStateReconciliation()) {
+    auto currentPublishedRevision = loadPublishedRevision();
+    const auto& currentRevision = currentPublishedRevision->revision;
+
+    if (isGranularStateReconciliationEnabled) {
       auto lastRevisionNumberWithNewStateChanged =
-          lastRevisionNumberWithNewState != lastRevisionNumberWithNewState_;
+          lastRevisionNumberWithNewState !=
+          currentPublishedRevision->lastRevisionNumberWithNewState;
       // Commit should only fail if we propagated the wrong state.
       if (commitOptions.enableStateReconciliation &&
           lastRevisionNumberWithNewStateChanged) {
         return CommitStatus::Failed;
       }
     } else {
-      if (currentRevision_.number != oldRevision.number) {
+      if (currentRevision.number != oldRevision.number) {
         return CommitStatus::Failed;
       }
     }
 
-    auto newRevisionNumber = currentRevision_.number + 1;
+    auto newRevisionNumber = currentRevision.number + 1;
 
-    {
-      std::scoped_lock dispatchLock(EventEmitter::DispatchMutex());
-      updateMountedFlag(
-          currentRevision_.rootShadowNode->getChildren(),
+    if (currentRevision.rootShadowNode != oldRootShadowNode) {
+      mountedFlagChanges = collectMountedFlagChanges(
+          currentRevision.rootShadowNode->getChildren(),
           newRootShadowNode->getChildren());
     }
 
+    // Guarded by `commitMutex_`: nodes (and event emitters) are never shared
+    // between surfaces, so no process-wide lock is needed here.
+    applyMountedFlagChanges(mountedFlagChanges);
+
     telemetry.didCommit();
     telemetry.setRevisionNumber(static_cast<int>(newRevisionNumber));
 
+    auto allocationCount = getThreadShadowNodeAllocationCount();
+    telemetry.setNumberOfAllocations(
+        static_cast<int>(
+            allocationCount.shadowNodes -
+            lastCommitAllocationCount.shadowNodes),
+        static_cast<int>(
+            allocationCount.childrenLists -
+            lastCommitAllocationCount.childrenLists));
+    lastCommitAllocationCount = allocationCount;
+
     // Seal the shadow node so it can no longer be mutated
     // Does nothing in release.
     newRootShadowNode->sealRecursive();
@@ -468,12 +518,25 @@ CommitStatus ShadowTree::tryCommit(
     newRevision = ShadowTreeRevision{
         std::move(newRootShadowNode), newRevisionNumber, telemetry};
 
-    currentRevision_ = newRevision;
-    if (!commitOptions.enableStateReconciliation) {
-      lastRevisionNumberWithNewState_ = newRevisionNumber;
+    publishRevision(std::make_shared<const PublishedRevision>(
+        PublishedRevision{
+            newRevision,
+            commitOptions.enableStateReconciliation
+                ? currentPublishedRevision->lastRevisionNumberWithNewState
+                : newRevisionNumber}));
+
+    // Updated after publishing, so the index can lag behind the current
+    // revision (and return the previous instance of a node) but never
+    // returns a node that isn't in a published revision.
+    {
+      std::unique_lock tagIndexLock(tagIndexMutex_);
+      tagIndex_.apply(mountedFlagChanges);
     }
   }
 
+  // Events processed from now on are attributed to the next commit.
+  EventQueueProcessor::resetOldestUncommittedEventTime();
+
   emitLayoutEvents(affectedLayoutableNodes);
 
   if (commitMode == CommitMode::Normal) {
@@ -484,8 +547,26 @@ CommitStatus ShadowTree::tryCommit(
 }
 
 ShadowTreeRevision ShadowTree::getCurrentRevision() const {
-  std::shared_lock lock(commitMutex_);
-  return currentRevision_;
+  return loadPublishedRevision()->revision;
+}
+
+ShadowNode::Shared ShadowTree::findShadowNodeByTag(Tag tag) const {
+  std::shared_lock lock(tagIndexMutex_);
+  return tagIndex_.find(tag);
+}
+
+std::shared_ptr<const ShadowTree::PublishedRevision>
+ShadowTree::loadPublishedRevision() const {
+  return std::atomic_load_explicit(
+      &publishedRevision_, std::memory_order_acquire);
+}
+
+void ShadowTree::publishRevision(
+    std::shared_ptr<const PublishedRevision> publishedRevision) const {
+  std::atomic_store_explicit(
+      &publishedRevision_,
+      std::move(publishedRevision),
+      std::memory_order_release);
 }
 
 void ShadowTree::mount(ShadowTreeRevision revision, bool mountSynchronously)
@@ -498,7 +579,7 @@ void ShadowTree::mount(ShadowTreeRevision revision, bool mountSynchronously)
 void ShadowTree::commitEmptyTree() const {
   commit(
       [](const RootShadowNode& oldRootShadowNode) -> RootShadowNode::Unshared {
-        return std::make_shared<RootShadowNode>(
+        return makeSharedShadowNode<RootShadowNode>(
             oldRootShadowNode,
             ShadowNodeFragment{
                 /* .props = */ ShadowNodeFragment::propsPlaceholder(),
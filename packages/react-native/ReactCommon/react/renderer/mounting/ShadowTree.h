@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 #include <react/renderer/components/root/RootComponentDescriptor.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -15,6 +18,7 @@
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowNodeTagIndex.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/utils/ContextContainer.h>
@@ -116,9 +120,19 @@ class ShadowTree final {
   /*
    * Returns a `ShadowTreeRevision` representing the momentary state of
    * the `ShadowTree`.
+   * Does not block on commits in progress.
    */
   ShadowTreeRevision getCurrentRevision() const;
 
+  /*
+   * Returns the shadow node with the given `tag` from the current revision,
+   * or `nullptr` if the tree doesn't contain one. The root node is not
+   * included. Does not traverse the tree.
+   * The index is updated right after a revision is published, so during a
+   * commit it may still return the node from the previous revision.
+   */
+  ShadowNode::Shared findShadowNodeByTag(Tag tag) const;
+
   /*
    * Commit an empty tree (a new `RootShadowNode` with no children).
    */
@@ -136,6 +150,22 @@ class ShadowTree final {
  private:
   constexpr static ShadowTreeRevision::Number INITIAL_REVISION{0};
 
+  /*
+   * Immutable state published by every commit. Readers load it atomically
+   * without taking `commitMutex_`; revision numbers increase monotonically.
+   * Note that atomic `shared_ptr` operations aren't lock-free: the standard
+   * library guards them with a short internal lock, which is still much
+   * cheaper than waiting for a commit in progress.
+   */
+  struct PublishedRevision {
+    ShadowTreeRevision revision;
+    ShadowTreeRevision::Number lastRevisionNumberWithNewState;
+  };
+
+  std::shared_ptr<const PublishedRevision> loadPublishedRevision() const;
+  void publishRevision(
+      std::shared_ptr<const PublishedRevision> publishedRevision) const;
+
   void mount(ShadowTreeRevision revision, bool mountSynchronously) const;
 
   void emitLayoutEvents(
@@ -143,12 +173,14 @@ class ShadowTree final {
 
   const SurfaceId surfaceId_;
   const ShadowTreeDelegate& delegate_;
-  mutable std::shared_mutex commitMutex_;
-  mutable CommitMode commitMode_{
-      CommitMode::Normal}; // Protected by `commitMutex_`.
-  mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
-  mutable ShadowTreeRevision::Number
-      lastRevisionNumberWithNewState_; // Protected by `commitMutex_`.
+  // Serializes writers only; readers never take it.
+  mutable std::mutex commitMutex_;
+  mutable std::atomic<CommitMode> commitMode_{
+      CommitMode::Normal}; // Written under `commitMutex_`.
+  mutable std::shared_ptr<const PublishedRevision>
+      publishedRevision_; // Accessed atomically, written under `commitMutex_`.
+  mutable std::shared_mutex tagIndexMutex_;
+  mutable ShadowNodeTagIndex tagIndex_; // Protected by `tagIndexMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
 };
 
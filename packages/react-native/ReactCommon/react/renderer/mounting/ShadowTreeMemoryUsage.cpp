@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ShadowTreeMemoryUsage.h"
+
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <unordered_set>
+
+namespace facebook::react {
+
+namespace {
+
+class MemoryUsageEstimator final {
+ public:
+  void addRevision(const ShadowTreeRevision& revision) {
+    if (revision.rootShadowNode == nullptr ||
+        !rootShadowNodes_.insert(revision.rootShadowNode.get()).second) {
+      return;
+    }
+
+    usage_.revisionCount++;
+    addShadowNode(*revision.rootShadowNode);
+  }
+
+  const ShadowTreeMemoryUsage& getUsage() const {
+    return usage_;
+  }
+
+ private:
+  void addShadowNode(const ShadowNode& shadowNode) {
+    // Nodes are immutable, so if the node was already visited (from another
+    // revision) so was its whole subtree.
+    if (!visitedShadowNodes_.insert(&shadowNode).second) {
+      addSharedShadowNode(shadowNode);
+      return;
+    }
+
+    const auto& componentDescriptor = shadowNode.getComponentDescriptor();
+
+    usage_.shadowNodeCount++;
+    usage_.shadowNodesSize +=
+        componentDescriptor.estimateShadowNodeSize(shadowNode);
+
+    const auto& props = shadowNode.getProps();
+    if (props != nullptr && visitedProps_.insert(props.get()).second) {
+      usage_.propsCount++;
+      usage_.propsSize += componentDescriptor.estimatePropsSize(*props);
+    }
+
+    const auto& state = shadowNode.getState();
+    if (state != nullptr && visitedStates_.insert(state.get()).second) {
+      usage_.stateCount++;
+      usage_.stateSize += componentDescriptor.estimateStateSize(*state);
+    }
+
+    // Clones share the list of children of the original node unless the
+    // children were changed.
+    const auto& children = shadowNode.getChildren();
+    if (visitedChildLists_.insert(&children).second) {
+      usage_.shadowNodesSize += sizeof(children) +
+          children.capacity() * sizeof(ShadowNode::Shared);
+    }
+
+    for (const auto& childShadowNode : children) {
+      addShadowNode(*childShadowNode);
+    }
+  }
+
+  /*
+   * Counts the nodes of the subtree of `shadowNode` as shared, unless they
+   * already were (when the subtree is shared by more than two revisions, or
+   * is part of a bigger subtree that was shared before).
+   */
+  void addSharedShadowNode(const ShadowNode& shadowNode) {
+    // Like visited nodes, the subtree of a node counted as shared was
+    // counted too.
+    if (!sharedShadowNodes_.insert(&shadowNode).second) {
+      return;
+    }
+
+    usage_.sharedShadowNodeCount++;
+    for (const auto& childShadowNode : shadowNode.getChildren()) {
+      addSharedShadowNode(*childShadowNode);
+    }
+  }
+
+  ShadowTreeMemoryUsage usage_;
+  std::unordered_set<const RootShadowNode*> rootShadowNodes_;
+  std::unordered_set<const ShadowNode*> visitedShadowNodes_;
+  std::unordered_set<const ShadowNode*> sharedShadowNodes_;
+  std::unordered_set<const Props*> visitedProps_;
+  std::unordered_set<const State*> visitedStates_;
+  std::unordered_set<const ShadowNode::ListOfShared*> visitedChildLists_;
+};
+
+} // namespace
+
+size_t ShadowTreeMemoryUsage::getTotalSize() const {
+  return shadowNodesSize + propsSize + stateSize;
+}
+
+ShadowTreeMemoryUsage& ShadowTreeMemoryUsage::operator+=(
+    const ShadowTreeMemoryUsage& rhs) {
+  revisionCount += rhs.revisionCount;
+  shadowNodeCount += rhs.shadowNodeCount;
+  shadowNodesSize += rhs.shadowNodesSize;
+  sharedShadowNodeCount += rhs.sharedShadowNodeCount;
+  propsCount += rhs.propsCount;
+  propsSize += rhs.propsSize;
+  stateCount += rhs.stateCount;
+  stateSize += rhs.stateSize;
+  return *this;
+}
+
+ShadowTreeMemoryUsage estimateMemoryUsage(
+    const std::vector<ShadowTreeRevision>& revisions) {
+  auto estimator = MemoryUsageEstimator{};
+  for (const auto& revision : revisions) {
+    estimator.addRevision(revision);
+  }
+  return estimator.getUsage();
+}
+
+ShadowTreeMemoryUsage estimateMemoryUsage(const ShadowTree& shadowTree) {
+  auto revisions = std::vector<ShadowTreeRevision>{};
+  revisions.push_back(shadowTree.getCurrentRevision());
+
+  const auto& mountingCoordinator = shadowTree.getMountingCoordinator();
+  revisions.push_back(mountingCoordinator->getBaseRevision());
+  if (auto pendingRevision = mountingCoordinator->getPendingRevision()) {
+    revisions.push_back(std::move(*pendingRevision));
+  }
+
+  return estimateMemoryUsage(revisions);
+}
+
+} // namespace facebook::react
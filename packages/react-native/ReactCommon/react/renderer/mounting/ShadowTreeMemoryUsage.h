@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeRevision.h>
+
+namespace facebook::react {
+
+/*
+ * Estimated memory used by a set of shadow tree revisions (e.g. the ones
+ * retained for a surface).
+ * Revisions only clone the nodes that changed, so most of their nodes, props
+ * and state are shared; shared objects are counted once.
+ * Sizes are estimated by the `ComponentDescriptor` of each node and are in
+ * bytes.
+ */
+struct ShadowTreeMemoryUsage {
+  size_t revisionCount{0};
+
+  size_t shadowNodeCount{0};
+  size_t shadowNodesSize{0}; // Including their lists of children.
+
+  // Number of nodes that are part of more than one of the revisions.
+  size_t sharedShadowNodeCount{0};
+
+  size_t propsCount{0};
+  size_t propsSize{0};
+
+  size_t stateCount{0};
+  size_t stateSize{0};
+
+  size_t getTotalSize() const;
+
+  ShadowTreeMemoryUsage& operator+=(const ShadowTreeMemoryUsage& rhs);
+};
+
+/*
+ * Walks all the nodes of the given revisions.
+ * Nodes are immutable, so this can be called from any thread.
+ */
+ShadowTreeMemoryUsage estimateMemoryUsage(
+    const std::vector<ShadowTreeRevision>& revisions);
+
+/*
+ * Estimates the memory used by the revisions retained by the shadow tree and
+ * its `MountingCoordinator`: the current revision, the mounted one and the
+ * one waiting to be mounted.
+ */
+ShadowTreeMemoryUsage estimateMemoryUsage(const ShadowTree& shadowTree);
+
+} // namespace facebook::react
@@ -29,7 +29,8 @@ ShadowView::ShadowView(const ShadowNode& shadowNode)
       props(shadowNode.getProps()),
       eventEmitter(shadowNode.getEventEmitter()),
       layoutMetrics(layoutMetricsFromShadowNode(shadowNode)),
-      state(shadowNode.getState()) {}
+      state(shadowNode.getState()),
+      family(&shadowNode.getFamily()) {}
 
 bool ShadowView::operator==(const ShadowView& rhs) const {
   return std::tie(
@@ -46,6 +46,10 @@ struct ShadowView final {
   EventEmitter::Shared eventEmitter{};
   LayoutMetrics layoutMetrics{EmptyLayoutMetrics};
   State::Shared state{};
+
+  // The family of the node the view describes. Not retained: only meant to
+  // identify the node (e.g. in `MountSummary`), and ignored by comparisons.
+  const ShadowNodeFamily* family{};
 };
 
 #if RN_DEBUG_STRING_CONVERTIBLE
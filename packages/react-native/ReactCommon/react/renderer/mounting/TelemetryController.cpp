@@ -39,15 +39,26 @@ bool TelemetryController::pullTransaction(
   doMount(transaction, compoundTelemetry);
   telemetry.didMount();
 
-  compoundTelemetry.incorporate(telemetry, numberOfMutations);
-
-  didMount(transaction, compoundTelemetry);
-
+  // Incorporated under the lock, so samples taken (and reset) concurrently
+  // with mounting aren't overwritten.
   mutex_.lock();
-  compoundTelemetry_ = compoundTelemetry;
+  compoundTelemetry_.incorporate(telemetry, numberOfMutations);
+  compoundTelemetry = compoundTelemetry_;
   mutex_.unlock();
 
+  didMount(transaction, compoundTelemetry);
+
   return true;
 }
 
+SurfaceTelemetry TelemetryController::sampleSurfaceTelemetry(
+    bool resetHistograms) const {
+  std::scoped_lock lock(mutex_);
+  auto surfaceTelemetry = compoundTelemetry_;
+  if (resetHistograms) {
+    compoundTelemetry_.resetHistograms();
+  }
+  return surfaceTelemetry;
+}
+
 } // namespace facebook::react
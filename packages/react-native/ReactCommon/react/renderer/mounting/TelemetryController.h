@@ -49,6 +49,13 @@ class TelemetryController final {
       const MountingTransactionCallback& doMount,
       const MountingTransactionCallback& didMount) const;
 
+  /*
+   * Returns a copy of the telemetry aggregated so far. Can be called from any
+   * thread. If `resetHistograms` is true, the histograms are cleared after
+   * being copied, so consecutive samples cover disjoint sets of transactions.
+   */
+  SurfaceTelemetry sampleSurfaceTelemetry(bool resetHistograms = false) const;
+
  private:
   const MountingCoordinator& mountingCoordinator_;
   mutable SurfaceTelemetry compoundTelemetry_{};
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "applyStateUpdates.h"
+
+#include <unordered_map>
+
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/ShadowNodeFragment.h>
+
+namespace facebook::react {
+
+RootShadowNode::Unshared applyStateUpdates(
+    const RootShadowNode& oldRootShadowNode,
+    const std::vector<StateUpdate>& stateUpdates) {
+  auto clonedByNativeStateTraits = ShadowNodeTraits();
+  clonedByNativeStateTraits.set(
+      ShadowNodeTraits::Trait::ClonedByNativeStateUpdate);
+
+  // Several updates of the same family are chained, in order, into one
+  // callback.
+  auto updatesByFamily = std::unordered_map<
+      const ShadowNodeFamily*,
+      std::vector<const StateUpdate::Callback*>>{};
+  for (const auto& stateUpdate : stateUpdates) {
+    updatesByFamily[stateUpdate.family.get()].push_back(&stateUpdate.callback);
+  }
+
+  auto callbacks = ShadowNode::CloneTreeCallbacks{};
+  callbacks.reserve(updatesByFamily.size());
+  for (const auto& [family, familyCallbacks] : updatesByFamily) {
+    callbacks.emplace(
+        family,
+        [&, &familyCallbacks = familyCallbacks](
+            const ShadowNode& oldShadowNode,
+            const ShadowNodeFragment& fragment) -> ShadowNode::Unshared {
+          const auto& shadowNodeFamily = oldShadowNode.getFamily();
+          auto data = oldShadowNode.getState()->getDataPointer();
+          auto isValid = false;
+
+          for (const auto* callback : familyCallbacks) {
+            // An update that is rejected is skipped, the following ones
+            // still apply on top of the last accepted data.
+            if (auto newData = (*callback)(data)) {
+              data = std::move(newData);
+              isValid = true;
+            }
+          }
+
+          if (!isValid) {
+            return nullptr;
+          }
+
+          auto newState =
+              shadowNodeFamily.getComponentDescriptor().createState(
+                  shadowNodeFamily, data);
+
+          return oldShadowNode.clone(
+              {.props = ShadowNodeFragment::propsPlaceholder(),
+               .children = fragment.children,
+               .state = newState,
+               .traits = clonedByNativeStateTraits});
+        });
+  }
+
+  return std::static_pointer_cast<RootShadowNode>(
+      oldRootShadowNode.cloneTree(callbacks, clonedByNativeStateTraits));
+}
+
+} // namespace facebook::react
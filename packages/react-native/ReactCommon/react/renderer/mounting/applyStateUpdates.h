@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/StateUpdate.h>
+
+namespace facebook::react {
+/*
+ * Returns a copy of `oldRootShadowNode` with all `stateUpdates` applied in
+ * order, so that any number of native state updates for the same surface can
+ * be committed in a single transaction. Updates whose callback returns
+ * `nullptr` and updates for families that are not part of the tree are
+ * skipped without affecting the others.
+ * Returns `nullptr` if no update was applied.
+ */
+RootShadowNode::Unshared applyStateUpdates(
+    const RootShadowNode& oldRootShadowNode,
+    const std::vector<StateUpdate>& stateUpdates);
+} // namespace facebook::react
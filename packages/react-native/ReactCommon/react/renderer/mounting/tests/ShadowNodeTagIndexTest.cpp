@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ShadowNodeTagIndex.h>
+
+#include <react/test_utils/Entropy.h>
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class ShadowNodeTagIndexTest : public ::testing::Test {
+ protected:
+  ShadowNodeTagIndexTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        viewComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            contextContainer_,
+            nullptr}) {}
+
+  ShadowNode::Shared createNode(
+      Tag tag,
+      const ShadowNode::ListOfShared& children = {}) {
+    auto family =
+        viewComponentDescriptor_.createFamily({tag, SurfaceId(1), nullptr});
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{
+            generateDefaultProps(viewComponentDescriptor_),
+            std::make_shared<const ShadowNode::ListOfShared>(children)},
+        family);
+  }
+
+  static ShadowNode::Shared withChildren(
+      const ShadowNode::Shared& shadowNode,
+      const ShadowNode::ListOfShared& children) {
+    return shadowNode->clone(
+        {ShadowNodeFragment::propsPlaceholder(),
+         std::make_shared<const ShadowNode::ListOfShared>(children)});
+  }
+
+  static void expectIndexMatchesTree(
+      const ShadowNodeTagIndex& index,
+      const ShadowNode::Shared& rootShadowNode) {
+    auto count = size_t{0};
+    traverseShadowTree(
+        rootShadowNode, [&](const ShadowTreeEdge& edge, bool& /*stop*/) {
+          EXPECT_EQ(index.find(edge.shadowNode->getTag()), edge.shadowNode);
+          count++;
+        });
+    EXPECT_EQ(index.size(), count);
+  }
+
+  std::shared_ptr<ContextContainer> contextContainer_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+};
+
+TEST_F(ShadowNodeTagIndexTest, indexesInsertedUpdatedAndRemovedNodes) {
+  auto index = ShadowNodeTagIndex{};
+
+  auto nodeA = createNode(2);
+  auto nodeB = createNode(3);
+  auto root = createNode(1, {createNode(10, {nodeA, nodeB})});
+  index.update({}, root->getChildren());
+  expectIndexMatchesTree(index, root);
+
+  // Cloning `nodeA` replaces it (and its ancestors) in the index.
+  auto container = root->getChildren().front();
+  auto clonedNodeA = nodeA->clone({});
+  auto newRoot =
+      withChildren(root, {withChildren(container, {clonedNodeA, nodeB})});
+  index.update(root->getChildren(), newRoot->getChildren());
+  expectIndexMatchesTree(index, newRoot);
+  EXPECT_EQ(index.find(2), clonedNodeA);
+
+  // Removing `nodeB`.
+  root = newRoot;
+  container = root->getChildren().front();
+  newRoot = withChildren(root, {withChildren(container, {clonedNodeA})});
+  index.update(root->getChildren(), newRoot->getChildren());
+  expectIndexMatchesTree(index, newRoot);
+  EXPECT_EQ(index.find(3), nullptr);
+
+  // Removing everything.
+  index.update(newRoot->getChildren(), {});
+  EXPECT_EQ(index.size(), 0);
+}
+
+TEST_F(ShadowNodeTagIndexTest, keepsReorderedNodes) {
+  auto index = ShadowNodeTagIndex{};
+
+  auto nodeA = createNode(2, {createNode(4)});
+  auto nodeB = createNode(3, {createNode(5)});
+  auto root = createNode(1, {nodeA, nodeB});
+  index.update({}, root->getChildren());
+
+  // Reordered nodes are both removed from and inserted into the index.
+  auto newRoot = withChildren(root, {nodeB, nodeA});
+  index.update(root->getChildren(), newRoot->getChildren());
+  expectIndexMatchesTree(index, newRoot);
+  EXPECT_EQ(index.size(), 4);
+}
+
+TEST_F(ShadowNodeTagIndexTest, matchesTreeAfterRandomMutations) {
+  auto entropy = Entropy();
+  auto rootComponentDescriptor =
+      RootComponentDescriptor(ComponentDescriptorParameters{
+          EventDispatcher::Shared{}, contextContainer_, nullptr});
+  auto family =
+      rootComponentDescriptor.createFamily({Tag(1), SurfaceId(1), nullptr});
+  auto emptyRootNode = std::static_pointer_cast<const RootShadowNode>(
+      rootComponentDescriptor.createShadowNode(
+          ShadowNodeFragment{RootShadowNode::defaultSharedProps()}, family));
+
+  auto currentRootNode = std::static_pointer_cast<const RootShadowNode>(
+      emptyRootNode->ShadowNode::clone(ShadowNodeFragment{
+          ShadowNodeFragment::propsPlaceholder(),
+          std::make_shared<ShadowNode::ListOfShared>(
+              ShadowNode::ListOfShared{generateShadowNodeTree(
+                  entropy, viewComponentDescriptor_, 64)})}));
+
+  auto index = ShadowNodeTagIndex{};
+  index.update({}, currentRootNode->getChildren());
+  expectIndexMatchesTree(index, currentRootNode);
+
+  for (int i = 0; i < 64; i++) {
+    auto nextRootNode = currentRootNode;
+    alterShadowTree(entropy, nextRootNode, &messWithChildren);
+
+    index.update(currentRootNode->getChildren(), nextRootNode->getChildren());
+    expectIndexMatchesTree(index, nextRootNode);
+
+    currentRootNode = nextRootNode;
+  }
+}
+
+} // namespace facebook::react
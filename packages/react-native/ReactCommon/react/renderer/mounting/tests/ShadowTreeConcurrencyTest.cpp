@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
+#include <react/utils/RendererPhase.h>
+
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class FakeShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      MountingCoordinator::Shared /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+class ShadowTreeConcurrencyTest : public ::testing::Test {
+ protected:
+  ShadowTreeConcurrencyTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        viewComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            contextContainer_,
+            nullptr}),
+        shadowTree_(
+            SurfaceId(1),
+            LayoutConstraints{},
+            LayoutContext{},
+            shadowTreeDelegate_,
+            *contextContainer_) {}
+
+  ShadowNode::Shared createNode(Tag tag) {
+    auto family =
+        viewComponentDescriptor_.createFamily({tag, SurfaceId(1), nullptr});
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{generateDefaultProps(viewComponentDescriptor_)},
+        family);
+  }
+
+  // Unlike the ones above, these nodes form views (they aren't flattened).
+  ShadowNode::Shared createViewNode(Tag tag) {
+    auto family =
+        viewComponentDescriptor_.createFamily({tag, SurfaceId(1), nullptr});
+    PropsParserContext parserContext{SurfaceId(1), *contextContainer_};
+    auto props = viewComponentDescriptor_.cloneProps(
+        parserContext,
+        nullptr,
+        RawProps(folly::dynamic::object("nativeID", "view")));
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{props}, family);
+  }
+
+  ShadowTree::CommitStatus commitChildren(
+      const ShadowNode::ListOfShared& children) {
+    return shadowTree_.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return makeSharedShadowNode<RootShadowNode>(
+              oldRootShadowNode,
+              ShadowNodeFragment{
+                  ShadowNodeFragment::propsPlaceholder(),
+                  std::make_shared<const ShadowNode::ListOfShared>(children)});
+        },
+        {});
+  }
+
+  std::shared_ptr<ContextContainer> contextContainer_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  FakeShadowTreeDelegate shadowTreeDelegate_;
+  ShadowTree shadowTree_;
+};
+
+TEST_F(ShadowTreeConcurrencyTest, publishesCommittedRevisions) {
+  auto initialRevision = shadowTree_.getCurrentRevision();
+
+  auto node = createNode(2);
+  EXPECT_EQ(commitChildren({node}), ShadowTree::CommitStatus::Succeeded);
+
+  auto revision = shadowTree_.getCurrentRevision();
+  EXPECT_EQ(revision.number, initialRevision.number + 1);
+  ASSERT_EQ(revision.rootShadowNode->getChildren().size(), 1);
+  EXPECT_EQ(shadowTree_.findShadowNodeByTag(2), node);
+  // The transaction cloned the root node (and the node was created since the
+  // previous commit on this thread).
+  EXPECT_GE(revision.telemetry.getNumberOfShadowNodeAllocations(), 2);
+
+  EXPECT_EQ(commitChildren({}), ShadowTree::CommitStatus::Succeeded);
+  EXPECT_EQ(shadowTree_.getCurrentRevision().number, revision.number + 1);
+  EXPECT_EQ(shadowTree_.findShadowNodeByTag(2), nullptr);
+}
+
+TEST_F(ShadowTreeConcurrencyTest, resetsRendererPhaseOfCancelledCommits) {
+  auto rendererPhase = std::atomic<RendererPhase>{RendererPhase::None};
+  auto previousWatcher = setRendererPhaseWatcher(&rendererPhase);
+
+  auto status = shadowTree_.tryCommit(
+      [](const RootShadowNode& /*oldRootShadowNode*/) {
+        return RootShadowNode::Unshared{};
+      },
+      {});
+
+  setRendererPhaseWatcher(previousWatcher);
+  EXPECT_EQ(status, ShadowTree::CommitStatus::Cancelled);
+  EXPECT_EQ(rendererPhase.load(), RendererPhase::None);
+}
+
+TEST_F(ShadowTreeConcurrencyTest, attributesTransactionsToEvents) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+
+  {
+    ScopedEventCausality causality(42);
+    EXPECT_EQ(
+        commitChildren({createNode(2)}), ShadowTree::CommitStatus::Succeeded);
+  }
+
+  {
+    ScopedEventCausality causality(43);
+    EXPECT_EQ(
+        commitChildren({createNode(3)}), ShadowTree::CommitStatus::Succeeded);
+  }
+
+  // Merged into the same transaction, so every event stays attributed.
+  EXPECT_EQ(
+      commitChildren({createNode(4)}), ShadowTree::CommitStatus::Succeeded);
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  const auto& telemetry = transaction->getTelemetry();
+  EXPECT_EQ(telemetry.getEventCausalityId(), kNoEventCausality);
+  EXPECT_EQ(
+      telemetry.getSupersededEventCausalityIds(),
+      (std::vector<EventCausalityId>{42, 43}));
+  EXPECT_TRUE(telemetry.hasEventCausality());
+
+  auto telemetries =
+      mountingCoordinator->takeMountSummary().eventTransactionTelemetries;
+  ASSERT_EQ(telemetries.size(), 1);
+  EXPECT_EQ(telemetries[0].getSupersededEventCausalityIds().size(), 2);
+
+  EXPECT_EQ(commitChildren({}), ShadowTree::CommitStatus::Succeeded);
+  transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_FALSE(transaction->getTelemetry().hasEventCausality());
+  EXPECT_TRUE(mountingCoordinator->takeMountSummary()
+                  .eventTransactionTelemetries.empty());
+}
+
+TEST_F(ShadowTreeConcurrencyTest, summarizesPulledTransactions) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+
+  auto node2 = createViewNode(2);
+  auto node3 = createViewNode(3);
+
+  {
+    ScopedEventCausality causality(42);
+    EXPECT_EQ(
+        commitChildren({node2, node3}), ShadowTree::CommitStatus::Succeeded);
+  }
+  ASSERT_TRUE(mountingCoordinator->pullTransaction().has_value());
+
+  EXPECT_EQ(commitChildren({node3}), ShadowTree::CommitStatus::Succeeded);
+  ASSERT_TRUE(mountingCoordinator->pullTransaction().has_value());
+
+  // Both transactions are summarized together.
+  auto summary = mountingCoordinator->takeMountSummary();
+  EXPECT_EQ(summary.surfaceId, SurfaceId(1));
+  EXPECT_EQ(
+      summary.rootShadowNode, shadowTree_.getCurrentRevision().rootShadowNode);
+  EXPECT_EQ(summary.revisionNumber, shadowTree_.getCurrentRevision().number);
+  EXPECT_EQ(summary.numberOfTransactions, 2);
+  // The root is laid out and updated, the nodes are created and inserted,
+  // then one of them is removed and deleted.
+  EXPECT_EQ(summary.numberOfMutations, 7);
+  EXPECT_TRUE(summary.hasAllChangedFamilies);
+  auto changedFamilies = std::vector<const ShadowNodeFamily*>{
+      &summary.rootShadowNode->getFamily(),
+      &node2->getFamily(),
+      &node3->getFamily()};
+  std::sort(changedFamilies.begin(), changedFamilies.end());
+  EXPECT_EQ(summary.changedFamilies, changedFamilies);
+  ASSERT_EQ(summary.eventTransactionTelemetries.size(), 1);
+  EXPECT_EQ(summary.eventTransactionTelemetries[0].getEventCausalityId(), 42);
+
+  summary = mountingCoordinator->takeMountSummary();
+  EXPECT_EQ(summary.numberOfMutations, 0);
+  EXPECT_TRUE(summary.changedFamilies.empty());
+  EXPECT_TRUE(summary.eventTransactionTelemetries.empty());
+}
+
+TEST_F(ShadowTreeConcurrencyTest, readersObserveMonotonicRevisions) {
+  constexpr int kCommitCount = 200;
+  constexpr int kCommitterCount = 2;
+  auto nodes = ShadowNode::ListOfShared{createNode(2), createNode(3)};
+
+  auto isCommitting = std::atomic<bool>{true};
+  auto readers = std::vector<std::thread>{};
+  for (int i = 0; i < 2; i++) {
+    readers.emplace_back([&]() {
+      auto lastNumber = shadowTree_.getCurrentRevision().number;
+      while (isCommitting) {
+        auto revision = shadowTree_.getCurrentRevision();
+        EXPECT_GE(revision.number, lastNumber);
+        EXPECT_NE(revision.rootShadowNode, nullptr);
+        lastNumber = revision.number;
+      }
+    });
+  }
+
+  auto committers = std::vector<std::thread>{};
+  for (int i = 0; i < kCommitterCount; i++) {
+    committers.emplace_back([&, i]() {
+      for (int j = 0; j < kCommitCount; j++) {
+        commitChildren({nodes[(i + j) % nodes.size()]});
+      }
+    });
+  }
+
+  for (auto& committer : committers) {
+    committer.join();
+  }
+  isCommitting = false;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  // Every commit succeeded exactly once.
+  EXPECT_EQ(
+      shadowTree_.getCurrentRevision().number, kCommitCount * kCommitterCount);
+}
+
+} // namespace facebook::react
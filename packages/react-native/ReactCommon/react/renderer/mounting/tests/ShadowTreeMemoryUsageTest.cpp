@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTreeMemoryUsage.h>
+
+namespace facebook::react {
+
+class ShadowTreeMemoryUsageTest : public ::testing::Test {
+ protected:
+  ShadowTreeMemoryUsageTest() : builder_(simpleComponentBuilder()) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .children({
+            Element<ViewShadowNode>()
+              .reference(viewShadowNodeA_)
+              .children({
+                Element<ViewShadowNode>()
+                  .reference(viewShadowNodeAA_),
+              }),
+            Element<ViewShadowNode>()
+              .reference(viewShadowNodeB_)
+              .children({
+                Element<ViewShadowNode>()
+                  .reference(viewShadowNodeBA_),
+              }),
+          });
+    // clang-format on
+
+    builder_.build(element);
+  }
+
+  ShadowTreeRevision createRevision(
+      RootShadowNode::Shared rootShadowNode,
+      ShadowTreeRevision::Number number) {
+    return ShadowTreeRevision{std::move(rootShadowNode), number, {}};
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeA_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeAA_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeB_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeBA_;
+};
+
+TEST_F(ShadowTreeMemoryUsageTest, countsEveryObjectOnce) {
+  auto revision = createRevision(rootShadowNode_, 1);
+
+  auto usage = estimateMemoryUsage({revision, revision});
+
+  EXPECT_EQ(usage.revisionCount, 1);
+  EXPECT_EQ(usage.shadowNodeCount, 5);
+  EXPECT_EQ(usage.sharedShadowNodeCount, 0);
+  EXPECT_GE(
+      usage.shadowNodesSize,
+      sizeof(RootShadowNode) + 4 * sizeof(ViewShadowNode));
+
+  // All the views use the same default props.
+  EXPECT_EQ(usage.propsCount, 2);
+  EXPECT_EQ(usage.propsSize, sizeof(RootProps) + sizeof(ViewProps));
+
+  EXPECT_EQ(usage.stateCount, 0);
+  EXPECT_EQ(usage.stateSize, 0);
+
+  EXPECT_EQ(
+      usage.getTotalSize(),
+      usage.shadowNodesSize + usage.propsSize + usage.stateSize);
+}
+
+TEST_F(ShadowTreeMemoryUsageTest, countsNodesSharedBetweenRevisions) {
+  // Cloning `AA` clones its ancestors (and Yoga clones `B`, as a child of the
+  // new root), but `BA` is shared by both revisions.
+  auto newRootShadowNode = std::static_pointer_cast<const RootShadowNode>(
+      rootShadowNode_->cloneTree(
+          viewShadowNodeAA_->getFamily(),
+          [](const ShadowNode& oldShadowNode) {
+            return oldShadowNode.clone({});
+          }));
+
+  auto oldUsage = estimateMemoryUsage({createRevision(rootShadowNode_, 1)});
+  auto usage = estimateMemoryUsage(
+      {createRevision(rootShadowNode_, 1),
+       createRevision(newRootShadowNode, 2)});
+
+  EXPECT_EQ(usage.revisionCount, 2);
+  EXPECT_EQ(usage.shadowNodeCount, 9);
+  EXPECT_EQ(usage.sharedShadowNodeCount, 1);
+  EXPECT_GT(usage.shadowNodesSize, oldUsage.shadowNodesSize);
+
+  // Clones share the props of the original nodes.
+  EXPECT_EQ(usage.propsCount, oldUsage.propsCount);
+  EXPECT_EQ(usage.propsSize, oldUsage.propsSize);
+}
+
+TEST_F(ShadowTreeMemoryUsageTest, countsNodesSharedByManyRevisionsOnce) {
+  auto cloneAA = [&](const RootShadowNode& rootShadowNode) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode.cloneTree(
+            viewShadowNodeAA_->getFamily(),
+            [](const ShadowNode& oldShadowNode) {
+              return oldShadowNode.clone({});
+            }));
+  };
+  auto secondRootShadowNode = cloneAA(*rootShadowNode_);
+  auto thirdRootShadowNode = cloneAA(*secondRootShadowNode);
+
+  auto usage = estimateMemoryUsage(
+      {createRevision(rootShadowNode_, 1),
+       createRevision(secondRootShadowNode, 2),
+       createRevision(thirdRootShadowNode, 3)});
+
+  EXPECT_EQ(usage.revisionCount, 3);
+  // `BA` is part of the three revisions (`B` is cloned by each one).
+  EXPECT_EQ(usage.sharedShadowNodeCount, 1);
+}
+
+} // namespace facebook::react
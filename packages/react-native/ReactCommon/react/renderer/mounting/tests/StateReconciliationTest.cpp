@@ -19,6 +19,7 @@
 #include <react/renderer/mounting/MountingCoordinator.h>
 #include <react/renderer/mounting/ShadowTree.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/mounting/applyStateUpdates.h>
 
 #include <react/renderer/element/testUtils.h>
 
@@ -52,6 +53,20 @@ class DummyShadowTreeDelegate : public ShadowTreeDelegate {
       bool mountSynchronously) const override {};
 };
 
+class CommitCountingShadowTreeDelegate : public DummyShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& oldRootShadowNode,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    commitCount++;
+    return DummyShadowTreeDelegate::shadowTreeWillCommit(
+        shadowTree, oldRootShadowNode, newRootShadowNode);
+  };
+
+  mutable int commitCount{0};
+};
+
 namespace {
 const ShadowNode* findDescendantNode(
     const ShadowNode& shadowNode,
@@ -923,6 +938,131 @@ TEST_P(StateReconciliationTest, testScrollViewWithChildrenAddition) {
       newState);
 }
 
+TEST_P(StateReconciliationTest, testBatchedStateUpdatesCommitOnce) {
+  // ==== SETUP ====
+
+  /*
+   <Root>
+    <View>
+      <ScrollView />
+      <ScrollView />
+      <ScrollView />
+    </View>
+   </Root>
+  */
+
+  auto scrollViewA = std::shared_ptr<ScrollViewShadowNode>{};
+  auto scrollViewB = std::shared_ptr<ScrollViewShadowNode>{};
+  auto scrollViewC = std::shared_ptr<ScrollViewShadowNode>{};
+
+  // clang-format off
+  auto element =
+      Element<RootShadowNode>()
+        .children({
+          Element<ViewShadowNode>()
+            .children({
+              Element<ScrollViewShadowNode>()
+                .reference(scrollViewA),
+              Element<ScrollViewShadowNode>()
+                .reference(scrollViewB),
+              Element<ScrollViewShadowNode>()
+                .reference(scrollViewC)
+            })
+        });
+  // clang-format on
+
+  ContextContainer contextContainer{};
+
+  auto initialRootShadowNode = builder_.build(element);
+
+  auto shadowTreeDelegate = CommitCountingShadowTreeDelegate{};
+  ShadowTree shadowTree{
+      SurfaceId{11},
+      LayoutConstraints{},
+      LayoutContext{},
+      shadowTreeDelegate,
+      contextContainer};
+
+  shadowTree.commit(
+      [&](const RootShadowNode& /*oldRootShadowNode*/) {
+        return std::static_pointer_cast<RootShadowNode>(
+            initialRootShadowNode->ShadowNode::clone({}));
+      },
+      {.enableStateReconciliation = true});
+
+  auto scrollViews = std::vector<std::shared_ptr<ScrollViewShadowNode>>{
+      scrollViewA, scrollViewB, scrollViewC};
+
+  auto makeStateUpdates = [&](Float offset) {
+    auto stateUpdates = std::vector<StateUpdate>{};
+    for (const auto& scrollView : scrollViews) {
+      stateUpdates.push_back(
+          {// Aliasing constructor, the node keeps the family alive.
+           .family = std::shared_ptr<const ShadowNodeFamily>(
+               scrollView, &scrollView->getFamily()),
+           .callback = [offset](const StateData::Shared& /*data*/) {
+             return std::make_shared<const ScrollViewState>(
+                 Point{0, offset}, Rect{}, 0);
+           }});
+    }
+    return stateUpdates;
+  };
+
+  auto contentOffsetOf = [&](const ShadowNode& scrollView) {
+    auto state =
+        std::static_pointer_cast<const ScrollViewShadowNode::ConcreteState>(
+            findDescendantNode(shadowTree, scrollView.getFamily())->getState());
+    return state->getData().contentOffset.y;
+  };
+
+  // ==== ONE COMMIT PER STATE UPDATE ====
+
+  shadowTreeDelegate.commitCount = 0;
+  for (const auto& stateUpdate : makeStateUpdates(10)) {
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return applyStateUpdates(oldRootShadowNode, {stateUpdate});
+        },
+        {.enableStateReconciliation = false});
+  }
+
+  EXPECT_EQ(shadowTreeDelegate.commitCount, 3);
+  for (const auto& scrollView : scrollViews) {
+    EXPECT_EQ(contentOffsetOf(*scrollView), 10);
+  }
+
+  // ==== ONE COMMIT FOR ALL STATE UPDATES ====
+
+  shadowTreeDelegate.commitCount = 0;
+  auto stateUpdates = makeStateUpdates(20);
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        return applyStateUpdates(oldRootShadowNode, stateUpdates);
+      },
+      {.enableStateReconciliation = false});
+
+  EXPECT_EQ(shadowTreeDelegate.commitCount, 1);
+  for (const auto& scrollView : scrollViews) {
+    EXPECT_EQ(contentOffsetOf(*scrollView), 20);
+  }
+
+  // ==== REJECTED STATE UPDATE DOESN'T AFFECT THE OTHERS ====
+
+  stateUpdates = makeStateUpdates(30);
+  stateUpdates[1].callback = [](const StateData::Shared& /*data*/) {
+    return StateData::Shared{};
+  };
+  shadowTree.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        return applyStateUpdates(oldRootShadowNode, stateUpdates);
+      },
+      {.enableStateReconciliation = false});
+
+  EXPECT_EQ(contentOffsetOf(*scrollViewA), 30);
+  EXPECT_EQ(contentOffsetOf(*scrollViewB), 20);
+  EXPECT_EQ(contentOffsetOf(*scrollViewC), 30);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     StateReconciliationTestInstantiation,
     StateReconciliationTest,
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/updateMountedFlag.h>
+
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class UpdateMountedFlagTest : public ::testing::Test {
+ protected:
+  UpdateMountedFlagTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        viewComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            contextContainer_,
+            nullptr}) {}
+
+  ShadowNode::Shared createNode(
+      Tag tag,
+      const ShadowNode::ListOfShared& children = {}) {
+    auto family =
+        viewComponentDescriptor_.createFamily({tag, SurfaceId(1), nullptr});
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{
+            generateDefaultProps(viewComponentDescriptor_),
+            std::make_shared<const ShadowNode::ListOfShared>(children)},
+        family);
+  }
+
+  static ShadowNode::Shared withChildren(
+      const ShadowNode::Shared& shadowNode,
+      const ShadowNode::ListOfShared& children) {
+    return shadowNode->clone(
+        {ShadowNodeFragment::propsPlaceholder(),
+         std::make_shared<const ShadowNode::ListOfShared>(children)});
+  }
+
+  static bool hasEventTarget(const ShadowNode::Shared& shadowNode) {
+    return shadowNode->getEventEmitter()->getEventTarget() != nullptr;
+  }
+
+  std::shared_ptr<ContextContainer> contextContainer_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+};
+
+TEST_F(UpdateMountedFlagTest, collectsChangedNodesInSinglePass) {
+  auto nodeA = createNode(2);
+  auto nodeB = createNode(3);
+  auto root = createNode(1, {nodeA, nodeB});
+
+  auto changes = collectMountedFlagChanges({}, root->getChildren());
+  EXPECT_EQ(changes.mountedNodes.size(), 2);
+  EXPECT_EQ(changes.unmountedNodes.size(), 0);
+  EXPECT_FALSE(nodeA->getHasBeenPromoted());
+
+  applyMountedFlagChanges(changes);
+  EXPECT_TRUE(nodeA->getHasBeenPromoted());
+  EXPECT_TRUE(nodeB->getHasBeenPromoted());
+
+  // Updating `nodeA` and removing `nodeB`.
+  auto clonedNodeA = nodeA->clone({});
+  auto newRoot = withChildren(root, {clonedNodeA});
+  changes =
+      collectMountedFlagChanges(root->getChildren(), newRoot->getChildren());
+  ASSERT_EQ(changes.mountedNodes.size(), 1);
+  EXPECT_EQ(*changes.mountedNodes.front(), clonedNodeA);
+  EXPECT_EQ(changes.unmountedNodes.size(), 2);
+  ASSERT_EQ(changes.removedTags.size(), 1);
+  EXPECT_EQ(changes.removedTags.front(), 3);
+
+  applyMountedFlagChanges(changes);
+  EXPECT_TRUE(clonedNodeA->getHasBeenPromoted());
+  EXPECT_TRUE(hasEventTarget(clonedNodeA));
+  EXPECT_FALSE(hasEventTarget(nodeB));
+
+  // Identical trees produce no changes.
+  changes = collectMountedFlagChanges(
+      newRoot->getChildren(), newRoot->getChildren());
+  EXPECT_TRUE(changes.mountedNodes.empty());
+  EXPECT_TRUE(changes.unmountedNodes.empty());
+}
+
+TEST_F(UpdateMountedFlagTest, keepsReorderedNodesMounted) {
+  auto nodeA = createNode(2, {createNode(4)});
+  auto nodeB = createNode(3, {createNode(5)});
+  auto root = createNode(1, {nodeA, nodeB});
+  updateMountedFlag({}, root->getChildren());
+
+  // Reordered nodes are unmounted and mounted again; mounting first keeps
+  // their event targets alive.
+  auto newRoot = withChildren(root, {nodeB, nodeA});
+  updateMountedFlag(root->getChildren(), newRoot->getChildren());
+
+  EXPECT_TRUE(hasEventTarget(nodeA));
+  EXPECT_TRUE(hasEventTarget(nodeB));
+  EXPECT_TRUE(hasEventTarget(nodeA->getChildren().front()));
+  EXPECT_TRUE(hasEventTarget(nodeB->getChildren().front()));
+}
+
+} // namespace facebook::react
@@ -8,13 +8,13 @@
 #include "updateMountedFlag.h"
 
 namespace facebook::react {
-void updateMountedFlag(
+
+static void collectMountedFlagChanges(
     const ShadowNode::ListOfShared& oldChildren,
-    const ShadowNode::ListOfShared& newChildren) {
-  // This is a simplified version of Diffing algorithm that only updates
-  // `mounted` flag on `ShadowNode`s. The algorithm sets "mounted" flag before
-  // "unmounted" to allow `ShadowNode` detect a situation where the node was
-  // remounted.
+    const ShadowNode::ListOfShared& newChildren,
+    MountedFlagChanges& changes) {
+  // This is a simplified version of Diffing algorithm that only collects
+  // nodes whose `mounted` flag changes.
 
   if (&oldChildren == &newChildren) {
     // Lists are identical, nothing to do.
@@ -44,10 +44,11 @@ void updateMountedFlag(
       break;
     }
 
-    newChild->setMounted(true);
-    oldChild->setMounted(false);
+    changes.mountedNodes.push_back(&newChild);
+    changes.unmountedNodes.push_back(oldChild.get());
 
-    updateMountedFlag(oldChild->getChildren(), newChild->getChildren());
+    collectMountedFlagChanges(
+        oldChild->getChildren(), newChild->getChildren(), changes);
   }
 
   size_t lastIndexAfterFirstStage = index;
@@ -55,15 +56,41 @@ void updateMountedFlag(
   // State 2: Mount new children.
   for (index = lastIndexAfterFirstStage; index < newChildren.size(); index++) {
     const auto& newChild = newChildren[index];
-    newChild->setMounted(true);
-    updateMountedFlag({}, newChild->getChildren());
+    changes.mountedNodes.push_back(&newChild);
+    collectMountedFlagChanges({}, newChild->getChildren(), changes);
   }
 
   // State 3: Unmount old children.
   for (index = lastIndexAfterFirstStage; index < oldChildren.size(); index++) {
     const auto& oldChild = oldChildren[index];
-    oldChild->setMounted(false);
-    updateMountedFlag(oldChild->getChildren(), {});
+    changes.unmountedNodes.push_back(oldChild.get());
+    changes.removedTags.push_back(oldChild->getTag());
+    collectMountedFlagChanges(oldChild->getChildren(), {}, changes);
+  }
+}
+
+MountedFlagChanges collectMountedFlagChanges(
+    const ShadowNode::ListOfShared& oldChildren,
+    const ShadowNode::ListOfShared& newChildren) {
+  auto changes = MountedFlagChanges{};
+  collectMountedFlagChanges(oldChildren, newChildren, changes);
+  return changes;
+}
+
+void applyMountedFlagChanges(const MountedFlagChanges& changes) {
+  for (const auto* shadowNode : changes.mountedNodes) {
+    (*shadowNode)->setMounted(true);
+  }
+
+  for (const auto* shadowNode : changes.unmountedNodes) {
+    shadowNode->setMounted(false);
   }
 }
+
+void updateMountedFlag(
+    const ShadowNode::ListOfShared& oldChildren,
+    const ShadowNode::ListOfShared& newChildren) {
+  applyMountedFlagChanges(collectMountedFlagChanges(oldChildren, newChildren));
+}
+
 } // namespace facebook::react
@@ -7,13 +7,57 @@
 
 #pragma once
 
+#include <vector>
+
+#include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
 
 namespace facebook::react {
+
+/*
+ * Nodes whose `mounted` flag changes between two revisions of a shadow tree.
+ * Entries point into the compared trees, which must outlive this object.
+ */
+struct MountedFlagChanges {
+  /*
+   * Nodes of the new tree that were inserted or updated.
+   */
+  std::vector<const ShadowNode::Shared*> mountedNodes;
+
+  /*
+   * Nodes of the old tree that were replaced or removed.
+   */
+  std::vector<const ShadowNode*> unmountedNodes;
+
+  /*
+   * Tags of the nodes of the old tree that were removed (rather than
+   * replaced with a newer clone). A tag might be inserted again at a
+   * different position.
+   */
+  std::vector<Tag> removedTags;
+};
+
+/*
+ * Collects the changes of the `mounted` flag in a single pass that only
+ * visits subtrees which differ between the two trees. Does not modify the
+ * nodes, so it's safe to call without holding the commit lock.
+ */
+MountedFlagChanges collectMountedFlagChanges(
+    const ShadowNode::ListOfShared& oldChildren,
+    const ShadowNode::ListOfShared& newChildren);
+
+/*
+ * Sets the `mounted` flag on all collected nodes.
+ * All nodes are mounted before any are unmounted, which lets a `ShadowNode`
+ * detect a situation where it was remounted.
+ */
+void applyMountedFlagChanges(const MountedFlagChanges& changes);
+
 /*
  * Traverses the shadow tree and updates the `mounted` flag on all nodes.
  */
 void updateMountedFlag(
     const ShadowNode::ListOfShared& oldChildren,
     const ShadowNode::ListOfShared& newChildren);
+
 } // namespace facebook::react
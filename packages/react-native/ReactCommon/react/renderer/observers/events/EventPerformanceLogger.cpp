@@ -10,17 +10,23 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/timing/primitives.h>
 #include <react/utils/CoreFeatures.h>
+#include <react/utils/Telemetry.h>
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace facebook::react {
 
 namespace {
 
-bool isTargetInRootShadowNode(
-    const SharedEventTarget& target,
-    const RootShadowNode::Shared& rootShadowNode) {
-  return target && rootShadowNode &&
-      target->getSurfaceId() == rootShadowNode->getSurfaceId();
+DOMHighResTimeStamp durationBetween(
+    TelemetryTimePoint startTime,
+    TelemetryTimePoint endTime) {
+  if (startTime == kTelemetryUndefinedTimePoint ||
+      endTime == kTelemetryUndefinedTimePoint) {
+    return 0.0;
+  }
+  return chronoToDOMHighResTimeStamp(endTime - startTime);
 }
 
 bool hasPendingRenderingUpdates(
@@ -167,15 +173,7 @@ void EventPerformanceLogger::onEventProcessingEnd(EventTag tag) {
       return;
     }
 
-    const auto& name = entry.name;
-
-    performanceEntryReporter->logEventEntry(
-        std::string(name),
-        entry.startTime,
-        timeStamp - entry.startTime,
-        entry.processingStartTime,
-        entry.processingEndTime,
-        entry.interactionId);
+    logEventEntry(*performanceEntryReporter, entry, timeStamp);
     eventsInFlight_.erase(it);
   }
 }
@@ -205,20 +203,17 @@ void EventPerformanceLogger::dispatchPendingEventTimingEntries(
       entry.isWaitingForMount = true;
       ++it;
     } else {
-      performanceEntryReporter->logEventEntry(
-          std::string(entry.name),
-          entry.startTime,
-          performanceEntryReporter->getCurrentTimeStamp() - entry.startTime,
-          entry.processingStartTime,
-          entry.processingEndTime,
-          entry.interactionId);
+      logEventEntry(
+          *performanceEntryReporter,
+          entry,
+          performanceEntryReporter->getCurrentTimeStamp());
       it = eventsInFlight_.erase(it);
     }
   }
 }
 
-void EventPerformanceLogger::shadowTreeDidMount(
-    const RootShadowNode::Shared& rootShadowNode,
+void EventPerformanceLogger::shadowTreesDidMount(
+    const std::vector<MountSummary>& mountSummaries,
     double mountTime) noexcept {
   if (!ReactNativeFeatureFlags::enableReportEventPaintTime()) {
     return;
@@ -229,19 +224,32 @@ void EventPerformanceLogger::shadowTreeDidMount(
     return;
   }
 
+  auto mountedSurfaceIds = std::unordered_set<SurfaceId>{};
+  mountedSurfaceIds.reserve(mountSummaries.size());
+
   std::lock_guard lock(eventsInFlightMutex_);
+  for (const auto& mountSummary : mountSummaries) {
+    if (mountSummary.rootShadowNode == nullptr) {
+      continue;
+    }
+
+    mountedSurfaceIds.insert(mountSummary.surfaceId);
+    addMountedTransactions(mountSummary.eventTransactionTelemetries, mountTime);
+  }
+
+  // Like on the Web, the entry ends with the first update presented after
+  // the event was processed, regardless of the surface it was targeting.
+  // Entries of events that weren't attributed to any transaction end with the
+  // first mount of the surface they target.
   auto it = eventsInFlight_.begin();
   while (it != eventsInFlight_.end()) {
     const auto& entry = it->second;
-    if (entry.isWaitingForMount &&
-        isTargetInRootShadowNode(entry.target, rootShadowNode)) {
-      performanceEntryReporter->logEventEntry(
-          std::string(entry.name),
-          entry.startTime,
-          mountTime - entry.startTime,
-          entry.processingStartTime,
-          entry.processingEndTime,
-          entry.interactionId);
+    auto hasMounted =
+        (entry.hasMountedTransactions && !entry.isWaitingForDispatch()) ||
+        (entry.isWaitingForMount && entry.target != nullptr &&
+         mountedSurfaceIds.contains(entry.target->getSurfaceId()));
+    if (hasMounted) {
+      logEventEntry(*performanceEntryReporter, entry, mountTime);
       it = eventsInFlight_.erase(it);
     } else {
       ++it;
@@ -254,4 +262,64 @@ EventTag EventPerformanceLogger::createEventTag() {
   return sCurrentEventTag_;
 }
 
+void EventPerformanceLogger::addMountedTransactions(
+    const std::vector<TransactionTelemetry>& transactionTelemetries,
+    double mountTime) {
+  for (const auto& telemetry : transactionTelemetries) {
+    addMountedTransaction(
+        telemetry, telemetry.getEventCausalityId(), mountTime);
+    for (auto causalityId : telemetry.getSupersededEventCausalityIds()) {
+      addMountedTransaction(telemetry, causalityId, mountTime);
+    }
+  }
+}
+
+void EventPerformanceLogger::addMountedTransaction(
+    const TransactionTelemetry& telemetry,
+    EventTag eventTag,
+    double mountTime) {
+  auto it = eventsInFlight_.find(eventTag);
+  if (it == eventsInFlight_.end()) {
+    return;
+  }
+
+  auto& entry = it->second;
+  entry.hasMountedTransactions = true;
+  entry.commitDuration += durationBetween(
+      telemetry.getCommitStartTime(), telemetry.getCommitEndTime());
+  entry.layoutDuration += durationBetween(
+      telemetry.getLayoutStartTime(), telemetry.getLayoutEndTime());
+  entry.diffDuration += durationBetween(
+      telemetry.getDiffStartTime(), telemetry.getDiffEndTime());
+  // Transactions mounted together wait for the mount concurrently.
+  if (telemetry.getDiffEndTime() != kTelemetryUndefinedTimePoint) {
+    entry.mountDuration = std::max(
+        entry.mountDuration,
+        mountTime - chronoToDOMHighResTimeStamp(telemetry.getDiffEndTime()));
+  }
+}
+
+void EventPerformanceLogger::logEventEntry(
+    PerformanceEntryReporter& performanceEntryReporter,
+    const EventEntry& entry,
+    DOMHighResTimeStamp endTime) {
+  auto performanceEntry = PerformanceEntry{
+      .name = entry.name,
+      .entryType = PerformanceEntryType::EVENT,
+      .startTime = entry.startTime,
+      .duration = endTime - entry.startTime,
+      .processingStart = entry.processingStartTime,
+      .processingEnd = entry.processingEndTime,
+      .interactionId = entry.interactionId};
+
+  if (entry.hasMountedTransactions) {
+    performanceEntry.commitDuration = entry.commitDuration;
+    performanceEntry.layoutDuration = entry.layoutDuration;
+    performanceEntry.diffDuration = entry.diffDuration;
+    performanceEntry.mountDuration = entry.mountDuration;
+  }
+
+  performanceEntryReporter.logEntry(performanceEntry);
+}
+
 } // namespace facebook::react
@@ -15,6 +15,7 @@
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace facebook::react {
 
@@ -40,8 +41,8 @@ class EventPerformanceLogger : public EventLogger,
 
 #pragma mark - UIManagerMountHook
 
-  void shadowTreeDidMount(
-      const RootShadowNode::Shared& rootShadowNode,
+  void shadowTreesDidMount(
+      const std::vector<MountSummary>& mountSummaries,
       double mountTime) noexcept override;
 
  private:
@@ -58,6 +59,13 @@ class EventPerformanceLogger : public EventLogger,
     // (T141358175)
     PerformanceEntryInteractionId interactionId{0};
 
+    // Accumulated over the mounted transactions caused by the event.
+    bool hasMountedTransactions{false};
+    DOMHighResTimeStamp commitDuration{0.0};
+    DOMHighResTimeStamp layoutDuration{0.0};
+    DOMHighResTimeStamp diffDuration{0.0};
+    DOMHighResTimeStamp mountDuration{0.0};
+
     bool isWaitingForDispatch() {
       return processingEndTime == 0.0;
     }
@@ -75,6 +83,19 @@ class EventPerformanceLogger : public EventLogger,
   EventTag sCurrentEventTag_{EMPTY_EVENT_TAG};
 
   EventTag createEventTag();
+
+  void addMountedTransactions(
+      const std::vector<TransactionTelemetry>& transactionTelemetries,
+      double mountTime);
+  void addMountedTransaction(
+      const TransactionTelemetry& telemetry,
+      EventTag eventTag,
+      double mountTime);
+
+  void logEventEntry(
+      PerformanceEntryReporter& performanceEntryReporter,
+      const EventEntry& entry,
+      DOMHighResTimeStamp endTime);
 };
 
 } // namespace facebook::react
@@ -43,6 +43,15 @@ class IntersectionObserver {
       const RootShadowNode& rootShadowNode,
       double time);
 
+  /*
+   * Same as above, with the ancestors of the target in `rootShadowNode`
+   * already known by the caller.
+   */
+  std::optional<IntersectionObserverEntry> updateIntersectionObservation(
+      const RootShadowNode& rootShadowNode,
+      const ShadowNodeFamily::AncestorList& targetAncestors,
+      double time);
+
   std::optional<IntersectionObserverEntry>
   updateIntersectionObservationForSurfaceUnmount(double time);
 
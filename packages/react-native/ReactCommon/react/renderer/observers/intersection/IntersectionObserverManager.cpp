@@ -24,20 +24,6 @@ void IntersectionObserverManager::observe(
 
   auto surfaceId = shadowNode->getSurfaceId();
 
-  // The actual observer lives in the array, so we need to create it there and
-  // then get a reference. Otherwise we only update its state in a copy.
-  IntersectionObserver* observer;
-
-  // Register observer
-  {
-    std::unique_lock lock(observersMutex_);
-
-    auto& observers = observersBySurfaceId_[surfaceId];
-    observers.emplace_back(IntersectionObserver{
-        intersectionObserverId, shadowNode, std::move(thresholds)});
-    observer = &observers.back();
-  }
-
   // Notification of initial state.
   // Ideally, we'd have well defined event loop step to notify observers
   // (like on the Web) and we'd send the initial notification there, but as
@@ -50,24 +36,33 @@ void IntersectionObserverManager::observe(
     rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
   });
 
-  // If the surface doesn't exist for some reason, we skip initial notification.
-  if (!rootShadowNode) {
-    return;
-  }
-
+  // If the surface doesn't exist for some reason, or it has transactions that
+  // weren't mounted yet, we skip initial notification.
   auto hasPendingTransactions = mountingCoordinator != nullptr &&
       mountingCoordinator->hasPendingTransactions();
+  if (hasPendingTransactions) {
+    rootShadowNode = nullptr;
+  }
 
-  if (!hasPendingTransactions) {
-    auto entry = observer->updateIntersectionObservation(
-        *rootShadowNode, JSExecutor::performanceNow());
-    if (entry) {
-      {
-        std::unique_lock lock(pendingEntriesMutex_);
-        pendingEntries_.push_back(std::move(entry).value());
-      }
-      notifyObserversIfNecessary();
+  // Register observer
+  std::optional<IntersectionObserverEntry> entry;
+  {
+    std::unique_lock lock(registriesMutex_);
+
+    entry = registriesBySurfaceId_[surfaceId].observe(
+        intersectionObserverId,
+        shadowNode,
+        std::move(thresholds),
+        rootShadowNode,
+        JSExecutor::performanceNow());
+  }
+
+  if (entry) {
+    {
+      std::unique_lock lock(pendingEntriesMutex_);
+      pendingEntries_.push_back(std::move(entry).value());
     }
+    notifyObserversIfNecessary();
   }
 }
 
@@ -77,31 +72,20 @@ void IntersectionObserverManager::unobserve(
   SystraceSection s("IntersectionObserverManager::unobserve");
 
   {
-    std::unique_lock lock(observersMutex_);
+    std::unique_lock lock(registriesMutex_);
 
     auto surfaceId = shadowNode.getSurfaceId();
 
-    auto observersIt = observersBySurfaceId_.find(surfaceId);
-    if (observersIt == observersBySurfaceId_.end()) {
+    auto registryIt = registriesBySurfaceId_.find(surfaceId);
+    if (registryIt == registriesBySurfaceId_.end()) {
       return;
     }
 
-    auto& observers = observersIt->second;
+    auto& registry = registryIt->second;
+    registry.unobserve(intersectionObserverId, shadowNode);
 
-    observers.erase(
-        std::remove_if(
-            observers.begin(),
-            observers.end(),
-            [intersectionObserverId, &shadowNode](const auto& observer) {
-              return observer.getIntersectionObserverId() ==
-                  intersectionObserverId &&
-                  ShadowNode::sameFamily(
-                         observer.getTargetShadowNode(), shadowNode);
-            }),
-        observers.end());
-
-    if (observers.empty()) {
-      observersBySurfaceId_.erase(surfaceId);
+    if (registry.isEmpty()) {
+      registriesBySurfaceId_.erase(registryIt);
     }
   }
 
@@ -162,24 +146,16 @@ IntersectionObserverManager::takeRecords() {
 
 #pragma mark - UIManagerMountHook
 
-void IntersectionObserverManager::shadowTreeDidMount(
-    const RootShadowNode::Shared& rootShadowNode,
-    double time) noexcept {
-  updateIntersectionObservations(
-      rootShadowNode->getSurfaceId(), rootShadowNode.get(), time);
-}
-
-void IntersectionObserverManager::shadowTreeDidUnmount(
-    SurfaceId surfaceId,
+void IntersectionObserverManager::shadowTreesDidMount(
+    const std::vector<MountSummary>& mountSummaries,
     double time) noexcept {
-  updateIntersectionObservations(surfaceId, nullptr, time);
+  updateIntersectionObservations(mountSummaries, time);
 }
 
 #pragma mark - Private methods
 
 void IntersectionObserverManager::updateIntersectionObservations(
-    SurfaceId surfaceId,
-    const RootShadowNode* rootShadowNode,
+    const std::vector<MountSummary>& mountSummaries,
     double time) {
   SystraceSection s(
       "IntersectionObserverManager::updateIntersectionObservations");
@@ -188,29 +164,28 @@ void IntersectionObserverManager::updateIntersectionObservations(
 
   // Run intersection observations
   {
-    std::shared_lock lock(observersMutex_);
+    std::unique_lock lock(registriesMutex_);
 
-    auto observersIt = observersBySurfaceId_.find(surfaceId);
-    if (observersIt == observersBySurfaceId_.end()) {
-      return;
-    }
-
-    auto& observers = observersIt->second;
-    for (auto& observer : observers) {
-      std::optional<IntersectionObserverEntry> entry;
-
-      if (rootShadowNode != nullptr) {
-        entry = observer.updateIntersectionObservation(*rootShadowNode, time);
-      } else {
-        entry = observer.updateIntersectionObservationForSurfaceUnmount(time);
+    for (const auto& mountSummary : mountSummaries) {
+      auto registryIt = registriesBySurfaceId_.find(mountSummary.surfaceId);
+      if (registryIt == registriesBySurfaceId_.end()) {
+        continue;
       }
 
-      if (entry) {
-        entries.push_back(std::move(entry).value());
+      auto& registry = registryIt->second;
+      if (mountSummary.rootShadowNode != nullptr) {
+        registry.updateIntersectionObservations(mountSummary, time, entries);
+      } else {
+        registry.updateIntersectionObservationsForSurfaceUnmount(
+            time, entries);
       }
     }
   }
 
+  if (entries.empty()) {
+    return;
+  }
+
   {
     std::unique_lock lock(pendingEntriesMutex_);
     pendingEntries_.insert(
@@ -13,6 +13,7 @@
 #include <react/renderer/uimanager/UIManagerMountHook.h>
 #include <vector>
 #include "IntersectionObserver.h"
+#include "IntersectionObserverRegistry.h"
 
 namespace facebook::react {
 
@@ -40,16 +41,14 @@ class IntersectionObserverManager final : public UIManagerMountHook {
 
 #pragma mark - UIManagerMountHook
 
-  void shadowTreeDidMount(
-      const RootShadowNode::Shared& rootShadowNode,
+  void shadowTreesDidMount(
+      const std::vector<MountSummary>& mountSummaries,
       double time) noexcept override;
 
-  void shadowTreeDidUnmount(SurfaceId surfaceId, double time) noexcept override;
-
  private:
-  mutable std::unordered_map<SurfaceId, std::vector<IntersectionObserver>>
-      observersBySurfaceId_;
-  mutable std::shared_mutex observersMutex_;
+  mutable std::unordered_map<SurfaceId, IntersectionObserverRegistry>
+      registriesBySurfaceId_;
+  mutable std::mutex registriesMutex_;
 
   mutable std::function<void()> notifyIntersectionObserversCallback_;
 
@@ -65,8 +64,7 @@ class IntersectionObserverManager final : public UIManagerMountHook {
   // Equivalent to
   // https://w3c.github.io/IntersectionObserver/#update-intersection-observations-algo
   void updateIntersectionObservations(
-      SurfaceId surfaceId,
-      const RootShadowNode* rootShadowNode,
+      const std::vector<MountSummary>& mountSummaries,
       double time);
 
   const IntersectionObserver& getRegisteredIntersectionObserver(
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "IntersectionObserverRegistry.h"
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <algorithm>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Returns whether anything the position of the node (or of its descendants)
+ * in the viewport depends on changed between both versions of the node:
+ * its layout metrics, or its props and state (which its transform, clipping
+ * and content offset are derived from).
+ * Nodes that were only cloned because one of their descendants changed
+ * don't move anything.
+ */
+bool hasGeometryChanged(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode) {
+  if (&oldShadowNode == &newShadowNode) {
+    return false;
+  }
+
+  if (oldShadowNode.getProps() != newShadowNode.getProps() ||
+      oldShadowNode.getState() != newShadowNode.getState()) {
+    return true;
+  }
+
+  auto oldLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&oldShadowNode);
+  auto newLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&newShadowNode);
+
+  if (oldLayoutableShadowNode == nullptr ||
+      newLayoutableShadowNode == nullptr) {
+    return oldLayoutableShadowNode != newLayoutableShadowNode;
+  }
+
+  return oldLayoutableShadowNode->getLayoutMetrics() !=
+      newLayoutableShadowNode->getLayoutMetrics();
+}
+
+bool formsView(const ShadowNode& shadowNode) {
+  return shadowNode.getTraits().check(ShadowNodeTraits::Trait::FormsView);
+}
+
+} // namespace
+
+std::optional<IntersectionObserverEntry> IntersectionObserverRegistry::observe(
+    IntersectionObserverObserverId intersectionObserverId,
+    ShadowNode::Shared targetShadowNode,
+    std::vector<Float> thresholds,
+    const RootShadowNode::Shared& rootShadowNode,
+    double time) {
+  const auto* family = &targetShadowNode->getFamily();
+  auto& observations = observationsByFamily_[family];
+  observations.push_back(Observation{IntersectionObserver{
+      intersectionObserverId,
+      std::move(targetShadowNode),
+      std::move(thresholds)}});
+  auto& observation = observations.back();
+  numberOfTargetsWithoutView_++;
+
+  auto entries = std::vector<IntersectionObserverEntry>{};
+  if (rootShadowNode != nullptr) {
+    updateObservation(observation, *rootShadowNode, time, entries);
+
+    // The new state can only be compared with the next mounted revision if
+    // it was computed in the last mounted one.
+    if (rootShadowNode != lastRootShadowNode_) {
+      observation.needsUpdate = true;
+    }
+  }
+
+  if (observation.needsUpdate) {
+    familiesNeedingUpdate_.insert(family);
+  }
+
+  if (entries.empty()) {
+    return std::nullopt;
+  }
+
+  return std::move(entries.front());
+}
+
+void IntersectionObserverRegistry::unobserve(
+    IntersectionObserverObserverId intersectionObserverId,
+    const ShadowNode& targetShadowNode) {
+  const auto* family = &targetShadowNode.getFamily();
+  auto it = observationsByFamily_.find(family);
+  if (it == observationsByFamily_.end()) {
+    return;
+  }
+
+  auto& observations = it->second;
+  for (auto& observation : observations) {
+    if (observation.observer.getIntersectionObserverId() ==
+        intersectionObserverId) {
+      clearPathFamilies(observation);
+      if (!observation.targetFormsView) {
+        numberOfTargetsWithoutView_--;
+      }
+    }
+  }
+
+  observations.erase(
+      std::remove_if(
+          observations.begin(),
+          observations.end(),
+          [intersectionObserverId](const Observation& observation) {
+            return observation.observer.getIntersectionObserverId() ==
+                intersectionObserverId;
+          }),
+      observations.end());
+
+  if (observations.empty()) {
+    observationsByFamily_.erase(it);
+    familiesNeedingUpdate_.erase(family);
+  }
+}
+
+bool IntersectionObserverRegistry::isEmpty() const {
+  return observationsByFamily_.empty();
+}
+
+void IntersectionObserverRegistry::updateIntersectionObservations(
+    const MountSummary& mountSummary,
+    double time,
+    std::vector<IntersectionObserverEntry>& entries) {
+  const auto& rootShadowNode = mountSummary.rootShadowNode;
+  if (lastRootShadowNode_ != nullptr && lastRootShadowNode_ != rootShadowNode &&
+      mayHaveMovedTargets(mountSummary)) {
+    auto ancestors = ShadowNodeFamily::AncestorList{};
+    updateObservationsInNode(
+        *lastRootShadowNode_,
+        *rootShadowNode,
+        *rootShadowNode,
+        ancestors,
+        false,
+        time,
+        entries);
+  }
+
+  lastRootShadowNode_ = rootShadowNode;
+
+  // Observers that can't be updated incrementally (including the ones whose
+  // targets were removed, found by the walk above) are evaluated from scratch.
+  auto families = std::move(familiesNeedingUpdate_);
+  familiesNeedingUpdate_.clear();
+
+  for (const auto* family : families) {
+    auto it = observationsByFamily_.find(family);
+    if (it == observationsByFamily_.end()) {
+      continue;
+    }
+
+    for (auto& observation : it->second) {
+      if (observation.needsUpdate) {
+        updateObservation(observation, *rootShadowNode, time, entries);
+      }
+
+      // Targets that aren't mounted are checked on every mount, in case they
+      // are inserted again.
+      if (observation.needsUpdate) {
+        familiesNeedingUpdate_.insert(family);
+      }
+    }
+  }
+}
+
+void IntersectionObserverRegistry::
+    updateIntersectionObservationsForSurfaceUnmount(
+        double time,
+        std::vector<IntersectionObserverEntry>& entries) {
+  for (auto& [family, observations] : observationsByFamily_) {
+    for (auto& observation : observations) {
+      auto entry =
+          observation.observer.updateIntersectionObservationForSurfaceUnmount(
+              time);
+      if (entry) {
+        entries.push_back(std::move(entry).value());
+      }
+
+      clearPathFamilies(observation);
+      observation.needsUpdate = true;
+    }
+
+    familiesNeedingUpdate_.insert(family);
+  }
+
+  lastRootShadowNode_ = nullptr;
+}
+
+void IntersectionObserverRegistry::updateObservation(
+    Observation& observation,
+    const RootShadowNode& rootShadowNode,
+    double time,
+    std::vector<IntersectionObserverEntry>& entries) {
+  auto ancestors =
+      observation.observer.getTargetShadowNode().getFamily().getAncestors(
+          rootShadowNode);
+
+  auto entry = observation.observer.updateIntersectionObservation(
+      rootShadowNode, ancestors, time);
+  if (entry) {
+    entries.push_back(std::move(entry).value());
+  }
+
+  setPathFamilies(observation, ancestors);
+  observation.needsUpdate = ancestors.empty();
+
+  if (!ancestors.empty()) {
+    const auto& [parentShadowNode, childIndex] = ancestors.back();
+    setTargetFormsView(
+        observation,
+        formsView(*parentShadowNode.get().getChildren()[childIndex]));
+  }
+}
+
+void IntersectionObserverRegistry::updateObservationsInNode(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode,
+    const RootShadowNode& rootShadowNode,
+    ShadowNodeFamily::AncestorList& ancestors,
+    bool ancestorsChanged,
+    double time,
+    std::vector<IntersectionObserverEntry>& entries) {
+  // If the nodes are referentially equal, their subtrees are also the same.
+  if (&oldShadowNode == &newShadowNode && !ancestorsChanged) {
+    return;
+  }
+
+  auto changed =
+      ancestorsChanged || hasGeometryChanged(oldShadowNode, newShadowNode);
+
+  if (changed) {
+    auto it = observationsByFamily_.find(&newShadowNode.getFamily());
+    if (it != observationsByFamily_.end()) {
+      for (auto& observation : it->second) {
+        if (observation.needsUpdate) {
+          continue;
+        }
+
+        auto entry = observation.observer.updateIntersectionObservation(
+            rootShadowNode, ancestors, time);
+        if (entry) {
+          entries.push_back(std::move(entry).value());
+        }
+
+        setTargetFormsView(observation, formsView(newShadowNode));
+      }
+    }
+  }
+
+  const auto& oldChildren = oldShadowNode.getChildren();
+  const auto& newChildren = newShadowNode.getChildren();
+
+  if (&oldChildren == &newChildren) {
+    // Nothing changed in the subtree itself, but the targets in it moved
+    // along with this node.
+    if (!changed) {
+      return;
+    }
+
+    for (size_t index = 0; index < newChildren.size(); index++) {
+      const auto& childShadowNode = *newChildren[index];
+      if (!isOnObservedPath(childShadowNode)) {
+        continue;
+      }
+
+      ancestors.emplace_back(newShadowNode, static_cast<int>(index));
+      updateObservationsInNode(
+          childShadowNode,
+          childShadowNode,
+          rootShadowNode,
+          ancestors,
+          true,
+          time,
+          entries);
+      ancestors.pop_back();
+    }
+
+    return;
+  }
+
+  auto newIndexByFamily = std::unordered_map<const ShadowNodeFamily*, size_t>{};
+
+  for (size_t oldIndex = 0; oldIndex < oldChildren.size(); oldIndex++) {
+    const auto& oldChildShadowNode = *oldChildren[oldIndex];
+    if (!isOnObservedPath(oldChildShadowNode)) {
+      continue;
+    }
+
+    // Most children keep their position, so the lookup is rarely needed.
+    auto newIndex = oldIndex;
+    if (newIndex >= newChildren.size() ||
+        !ShadowNode::sameFamily(oldChildShadowNode, *newChildren[newIndex])) {
+      if (newIndexByFamily.empty()) {
+        newIndexByFamily.reserve(newChildren.size());
+        for (size_t index = 0; index < newChildren.size(); index++) {
+          newIndexByFamily.emplace(&newChildren[index]->getFamily(), index);
+        }
+      }
+
+      auto it = newIndexByFamily.find(&oldChildShadowNode.getFamily());
+      if (it == newIndexByFamily.end()) {
+        markObservationsInRemovedNode(oldChildShadowNode);
+        continue;
+      }
+      newIndex = it->second;
+    }
+
+    ancestors.emplace_back(newShadowNode, static_cast<int>(newIndex));
+    updateObservationsInNode(
+        oldChildShadowNode,
+        *newChildren[newIndex],
+        rootShadowNode,
+        ancestors,
+        changed,
+        time,
+        entries);
+    ancestors.pop_back();
+  }
+}
+
+void IntersectionObserverRegistry::markObservationsInRemovedNode(
+    const ShadowNode& oldShadowNode) {
+  if (!isOnObservedPath(oldShadowNode)) {
+    return;
+  }
+
+  // The targets in the node are no longer in the tree (they might be inserted
+  // again later).
+  auto it = observationsByFamily_.find(&oldShadowNode.getFamily());
+  if (it != observationsByFamily_.end()) {
+    for (auto& observation : it->second) {
+      observation.needsUpdate = true;
+    }
+    familiesNeedingUpdate_.insert(it->first);
+  }
+
+  for (const auto& childShadowNode : oldShadowNode.getChildren()) {
+    markObservationsInRemovedNode(*childShadowNode);
+  }
+}
+
+void IntersectionObserverRegistry::setPathFamilies(
+    Observation& observation,
+    const ShadowNodeFamily::AncestorList& ancestors) {
+  clearPathFamilies(observation);
+
+  if (ancestors.empty()) {
+    return;
+  }
+
+  observation.pathFamilies.reserve(ancestors.size() + 1);
+  for (const auto& [parentShadowNode, childIndex] : ancestors) {
+    observation.pathFamilies.push_back(&parentShadowNode.get().getFamily());
+  }
+  observation.pathFamilies.push_back(
+      &observation.observer.getTargetShadowNode().getFamily());
+
+  for (const auto* family : observation.pathFamilies) {
+    pathCountsByFamily_[family]++;
+  }
+}
+
+void IntersectionObserverRegistry::clearPathFamilies(Observation& observation) {
+  for (const auto* family : observation.pathFamilies) {
+    auto it = pathCountsByFamily_.find(family);
+    if (--it->second == 0) {
+      pathCountsByFamily_.erase(it);
+    }
+  }
+
+  observation.pathFamilies.clear();
+}
+
+bool IntersectionObserverRegistry::isOnObservedPath(
+    const ShadowNode& shadowNode) const {
+  return pathCountsByFamily_.find(&shadowNode.getFamily()) !=
+      pathCountsByFamily_.end();
+}
+
+bool IntersectionObserverRegistry::mayHaveMovedTargets(
+    const MountSummary& mountSummary) const {
+  // Targets (and their ancestors) that form views are mutated when they move
+  // or are resized, and flattened ancestors that move shift the views in
+  // them.
+  if (!mountSummary.hasAllChangedFamilies || numberOfTargetsWithoutView_ > 0) {
+    return true;
+  }
+
+  return std::any_of(
+      mountSummary.changedFamilies.begin(),
+      mountSummary.changedFamilies.end(),
+      [this](const ShadowNodeFamily* family) {
+        return pathCountsByFamily_.find(family) != pathCountsByFamily_.end();
+      });
+}
+
+void IntersectionObserverRegistry::setTargetFormsView(
+    Observation& observation,
+    bool targetFormsView) {
+  if (observation.targetFormsView == targetFormsView) {
+    return;
+  }
+
+  observation.targetFormsView = targetFormsView;
+  if (targetFormsView) {
+    numberOfTargetsWithoutView_--;
+  } else {
+    numberOfTargetsWithoutView_++;
+  }
+}
+
+} // namespace facebook::react
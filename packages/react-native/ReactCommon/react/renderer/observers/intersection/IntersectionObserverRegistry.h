@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/graphics/Float.h>
+#include <react/renderer/mounting/MountSummary.h>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "IntersectionObserver.h"
+
+namespace facebook::react {
+
+/*
+ * Intersection observers of a surface, indexed by the family of their target.
+ * Every mounted revision is compared with the previous one in a single walk
+ * that only follows the paths leading to observed targets. A target is only
+ * evaluated again when its own geometry, or the geometry of one of its
+ * ancestors (layout metrics, props or state), changed in between, so the cost
+ * of a mount is proportional to what moved rather than to the number of
+ * observers. The walk is skipped altogether when the families changed by the
+ * mount (see `MountSummary`) aren't on the path of any target.
+ */
+class IntersectionObserverRegistry final {
+ public:
+  /*
+   * Registers the observer and, if `rootShadowNode` is provided, computes its
+   * initial state in that tree.
+   */
+  std::optional<IntersectionObserverEntry> observe(
+      IntersectionObserverObserverId intersectionObserverId,
+      ShadowNode::Shared targetShadowNode,
+      std::vector<Float> thresholds,
+      const RootShadowNode::Shared& rootShadowNode,
+      double time);
+
+  void unobserve(
+      IntersectionObserverObserverId intersectionObserverId,
+      const ShadowNode& targetShadowNode);
+
+  bool isEmpty() const;
+
+  /*
+   * Updates the observers after `mountSummary.rootShadowNode` (which must be
+   * set) was mounted.
+   */
+  void updateIntersectionObservations(
+      const MountSummary& mountSummary,
+      double time,
+      std::vector<IntersectionObserverEntry>& entries);
+
+  void updateIntersectionObservationsForSurfaceUnmount(
+      double time,
+      std::vector<IntersectionObserverEntry>& entries);
+
+ private:
+  struct Observation {
+    IntersectionObserver observer;
+
+    // Families from the root to the target (inclusive) in the last tree the
+    // observer was evaluated in. Empty if the target wasn't in that tree.
+    std::vector<const ShadowNodeFamily*> pathFamilies;
+
+    // Set when the observer has to be evaluated from scratch on the next
+    // mount (e.g. it was never evaluated, or its target was removed).
+    bool needsUpdate{true};
+
+    // Whether the target formed a view the last time it was evaluated.
+    // Flattened targets aren't mutated when they move or are resized, so
+    // mounts can't be skipped based on the changed families while there are
+    // any.
+    bool targetFormsView{false};
+  };
+
+  using Observations = std::vector<Observation>;
+
+  void updateObservation(
+      Observation& observation,
+      const RootShadowNode& rootShadowNode,
+      double time,
+      std::vector<IntersectionObserverEntry>& entries);
+
+  void updateObservationsInNode(
+      const ShadowNode& oldShadowNode,
+      const ShadowNode& newShadowNode,
+      const RootShadowNode& rootShadowNode,
+      ShadowNodeFamily::AncestorList& ancestors,
+      bool ancestorsChanged,
+      double time,
+      std::vector<IntersectionObserverEntry>& entries);
+
+  void markObservationsInRemovedNode(const ShadowNode& oldShadowNode);
+
+  void setPathFamilies(
+      Observation& observation,
+      const ShadowNodeFamily::AncestorList& ancestors);
+
+  void clearPathFamilies(Observation& observation);
+
+  bool isOnObservedPath(const ShadowNode& shadowNode) const;
+
+  bool mayHaveMovedTargets(const MountSummary& mountSummary) const;
+
+  void setTargetFormsView(Observation& observation, bool targetFormsView);
+
+  std::unordered_map<const ShadowNodeFamily*, Observations>
+      observationsByFamily_;
+
+  // Number of observations with each family in their `pathFamilies`.
+  std::unordered_map<const ShadowNodeFamily*, size_t> pathCountsByFamily_;
+
+  // Number of observations whose target isn't known to form a view.
+  size_t numberOfTargetsWithoutView_{0};
+
+  // Families with at least one observation that `needsUpdate`.
+  std::unordered_set<const ShadowNodeFamily*> familiesNeedingUpdate_;
+
+  // The tree the observers were last evaluated against, retained until the
+  // next mount so it can be compared with it.
+  RootShadowNode::Shared lastRootShadowNode_;
+};
+
+} // namespace facebook::react
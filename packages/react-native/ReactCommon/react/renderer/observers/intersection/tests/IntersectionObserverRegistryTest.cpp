@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/observers/intersection/IntersectionObserverRegistry.h>
+
+namespace facebook::react {
+
+namespace {
+
+LayoutMetrics layoutMetricsWithFrame(Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  return layoutMetrics;
+}
+
+} // namespace
+
+/*
+ * Root (100x100)
+ *  ├── Container A (0, 0, 100x100)
+ *  │    ├── Target 1 (0, 0, 10x10)
+ *  │    └── Target 2 (0, 200, 10x10)
+ *  └── Container B (0, 200, 100x100)
+ */
+class IntersectionObserverRegistryTest : public ::testing::Test {
+ protected:
+  IntersectionObserverRegistryTest() : builder_(simpleComponentBuilder()) {
+    // The nodes form views, so they are mutated when they change.
+    auto viewElement = [](Rect frame) {
+      return Element<ViewShadowNode>()
+          .props([] {
+            auto props = std::make_shared<ViewShadowNodeProps>();
+            props->nativeId = "view";
+            return props;
+          })
+          .finalize([frame](ViewShadowNode& shadowNode) {
+            shadowNode.setLayoutMetrics(layoutMetricsWithFrame(frame));
+          });
+    };
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .finalize([](RootShadowNode &shadowNode) {
+            shadowNode.setLayoutMetrics(
+                layoutMetricsWithFrame({{0, 0}, {100, 100}}));
+          })
+          .children({
+            viewElement({{0, 0}, {100, 100}})
+              .reference(containerA_)
+              .children({
+                viewElement({{0, 0}, {10, 10}})
+                  .reference(target1_),
+                viewElement({{0, 200}, {10, 10}})
+                  .reference(target2_),
+              }),
+            viewElement({{0, 200}, {100, 100}})
+              .reference(containerB_),
+          });
+    // clang-format on
+
+    builder_.build(element);
+  }
+
+  RootShadowNode::Shared cloneWithFrame(
+      const RootShadowNode& rootShadowNode,
+      const ShadowNode& shadowNode,
+      Rect frame) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode.cloneTree(
+            shadowNode.getFamily(), [&](const ShadowNode& oldShadowNode) {
+              auto newShadowNode = oldShadowNode.clone({});
+              dynamic_cast<LayoutableShadowNode&>(*newShadowNode)
+                  .setLayoutMetrics(layoutMetricsWithFrame(frame));
+              return newShadowNode;
+            }));
+  }
+
+  RootShadowNode::Shared cloneWithChildren(
+      const RootShadowNode& rootShadowNode,
+      const ShadowNode& shadowNode,
+      const ShadowNode::ListOfShared& children) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode.cloneTree(
+            shadowNode.getFamily(), [&](const ShadowNode& oldShadowNode) {
+              return oldShadowNode.clone(
+                  {ShadowNodeFragment::propsPlaceholder(),
+                   std::make_shared<const ShadowNode::ListOfShared>(
+                       children)});
+            }));
+  }
+
+  std::vector<IntersectionObserverEntry> mount(
+      const RootShadowNode::Shared& rootShadowNode) {
+    auto mountSummary = MountSummary{};
+    mountSummary.rootShadowNode = rootShadowNode;
+    if (mountedRootShadowNode_ != nullptr) {
+      mountSummary.addMutations(calculateShadowViewMutations(
+          *mountedRootShadowNode_, *rootShadowNode));
+    } else {
+      mountSummary.hasAllChangedFamilies = false;
+    }
+    return mount(mountSummary);
+  }
+
+  std::vector<IntersectionObserverEntry> mount(
+      const MountSummary& mountSummary) {
+    mountedRootShadowNode_ = mountSummary.rootShadowNode;
+    auto entries = std::vector<IntersectionObserverEntry>{};
+    registry_.updateIntersectionObservations(mountSummary, 0, entries);
+    return entries;
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> containerA_;
+  std::shared_ptr<ViewShadowNode> containerB_;
+  std::shared_ptr<ViewShadowNode> target1_;
+  std::shared_ptr<ViewShadowNode> target2_;
+  RootShadowNode::Shared mountedRootShadowNode_;
+  IntersectionObserverRegistry registry_;
+};
+
+TEST_F(IntersectionObserverRegistryTest, reportsInitialStateOnObserve) {
+  auto entry = registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(entry->intersectionObserverId, 1);
+  EXPECT_EQ(entry->shadowNode, target1_);
+  EXPECT_TRUE(entry->isIntersectingAboveThresholds);
+
+  entry = registry_.observe(1, target2_, {0}, rootShadowNode_, 0);
+
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_FALSE(entry->isIntersectingAboveThresholds);
+
+  // The states were already reported.
+  EXPECT_TRUE(mount(rootShadowNode_).empty());
+}
+
+TEST_F(IntersectionObserverRegistryTest, updatesTargetsThatMoved) {
+  registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+  registry_.observe(1, target2_, {0}, rootShadowNode_, 0);
+  mount(rootShadowNode_);
+
+  // Moving a target only updates that target.
+  auto rootShadowNode =
+      cloneWithFrame(*rootShadowNode_, *target2_, {{0, 50}, {10, 10}});
+
+  auto entries = mount(rootShadowNode);
+
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_TRUE(ShadowNode::sameFamily(*entries[0].shadowNode, *target2_));
+  EXPECT_TRUE(entries[0].isIntersectingAboveThresholds);
+
+  // Changes elsewhere in the tree don't update anything.
+  rootShadowNode =
+      cloneWithFrame(*rootShadowNode, *containerB_, {{0, 300}, {100, 100}});
+
+  EXPECT_TRUE(mount(rootShadowNode).empty());
+
+  // Moving an ancestor moves all the targets in it.
+  rootShadowNode =
+      cloneWithFrame(*rootShadowNode, *containerA_, {{0, 100}, {100, 100}});
+
+  entries = mount(rootShadowNode);
+
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+  EXPECT_FALSE(entries[1].isIntersectingAboveThresholds);
+}
+
+TEST_F(IntersectionObserverRegistryTest, skipsMountsThatDidNotChangeTargets) {
+  registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+  mount(rootShadowNode_);
+
+  auto rootShadowNode =
+      cloneWithFrame(*rootShadowNode_, *target1_, {{0, 200}, {10, 10}});
+
+  // Only the families changed by the mount are considered.
+  auto mountSummary = MountSummary{};
+  mountSummary.rootShadowNode = rootShadowNode;
+  mountSummary.changedFamilies = {&containerB_->getFamily()};
+
+  EXPECT_TRUE(mount(mountSummary).empty());
+
+  // Unless the summary doesn't know what changed.
+  rootShadowNode =
+      cloneWithFrame(*rootShadowNode, *target1_, {{0, 300}, {10, 10}});
+  mountSummary.rootShadowNode = rootShadowNode;
+  mountSummary.changedFamilies.clear();
+  mountSummary.hasAllChangedFamilies = false;
+
+  auto entries = mount(mountSummary);
+
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+}
+
+TEST_F(IntersectionObserverRegistryTest, updatesTargetsThatWereReordered) {
+  registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+  mount(rootShadowNode_);
+
+  auto rootShadowNode =
+      cloneWithChildren(*rootShadowNode_, *containerA_, {target2_, target1_});
+
+  EXPECT_TRUE(mount(rootShadowNode).empty());
+
+  rootShadowNode =
+      cloneWithFrame(*rootShadowNode, *target1_, {{0, 200}, {10, 10}});
+
+  auto entries = mount(rootShadowNode);
+
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+}
+
+TEST_F(IntersectionObserverRegistryTest, updatesTargetsThatWereRemoved) {
+  registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+  registry_.observe(2, target1_, {0}, rootShadowNode_, 0);
+  mount(rootShadowNode_);
+
+  auto rootShadowNode =
+      cloneWithChildren(*rootShadowNode_, *containerA_, {target2_});
+
+  auto entries = mount(rootShadowNode);
+
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].intersectionObserverId, 1);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+  EXPECT_EQ(entries[1].intersectionObserverId, 2);
+  EXPECT_FALSE(entries[1].isIntersectingAboveThresholds);
+
+  // Inserting it again.
+  entries = mount(rootShadowNode_);
+
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_TRUE(entries[0].isIntersectingAboveThresholds);
+
+  registry_.unobserve(1, *target1_);
+  EXPECT_FALSE(registry_.isEmpty());
+
+  registry_.unobserve(2, *target1_);
+  EXPECT_TRUE(registry_.isEmpty());
+}
+
+TEST_F(IntersectionObserverRegistryTest, updatesAllTargetsOnSurfaceUnmount) {
+  registry_.observe(1, target1_, {0}, rootShadowNode_, 0);
+  mount(rootShadowNode_);
+
+  auto entries = std::vector<IntersectionObserverEntry>{};
+  registry_.updateIntersectionObservationsForSurfaceUnmount(0, entries);
+
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+
+  entries = mount(rootShadowNode_);
+
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_TRUE(entries[0].isIntersectingAboveThresholds);
+}
+
+} // namespace facebook::react
@@ -23,17 +23,8 @@ void MutationObserverManager::observe(
 
   auto surfaceId = shadowNode->getSurfaceId();
 
-  auto& observers = observersBySurfaceId_[surfaceId];
-
-  auto observerIt = observers.find(mutationObserverId);
-  if (observerIt == observers.end()) {
-    auto observer = MutationObserver{mutationObserverId};
-    observer.observe(shadowNode, observeSubtree);
-    observers.insert({mutationObserverId, std::move(observer)});
-  } else {
-    auto observer = observerIt->second;
-    observer.observe(shadowNode, observeSubtree);
-  }
+  registriesBySurfaceId_[surfaceId].observe(
+      mutationObserverId, std::move(shadowNode), observeSubtree);
 }
 
 void MutationObserverManager::unobserve(
@@ -43,28 +34,17 @@ void MutationObserverManager::unobserve(
 
   auto surfaceId = shadowNode.getSurfaceId();
 
-  auto observersIt = observersBySurfaceId_.find(surfaceId);
-  if (observersIt == observersBySurfaceId_.end()) {
-    return;
-  }
-
-  auto& observers = observersIt->second;
-
-  auto observerIt = observers.find(mutationObserverId);
-  if (observerIt == observers.end()) {
+  auto registryIt = registriesBySurfaceId_.find(surfaceId);
+  if (registryIt == registriesBySurfaceId_.end()) {
     return;
   }
 
-  auto& observer = observerIt->second;
-
-  observer.unobserve(shadowNode);
+  auto& registry = registryIt->second;
 
-  if (!observer.isObserving()) {
-    observers.erase(mutationObserverId);
-  }
+  registry.unobserve(mutationObserverId, shadowNode);
 
-  if (observers.empty()) {
-    observersBySurfaceId_.erase(surfaceId);
+  if (registry.isEmpty()) {
+    registriesBySurfaceId_.erase(registryIt);
   }
 }
 
@@ -119,18 +99,16 @@ void MutationObserverManager::runMutationObservations(
 
   auto surfaceId = shadowTree.getSurfaceId();
 
-  auto observersIt = observersBySurfaceId_.find(surfaceId);
-  if (observersIt == observersBySurfaceId_.end()) {
+  auto registryIt = registriesBySurfaceId_.find(surfaceId);
+  if (registryIt == registriesBySurfaceId_.end()) {
     return;
   }
 
   std::vector<MutationRecord> mutationRecords;
 
-  auto& observers = observersIt->second;
-  for (const auto& [mutationObserverId, observer] : observers) {
-    observer.recordMutations(
-        oldRootShadowNode, newRootShadowNode, mutationRecords);
-  }
+  // A single walk over the changed parts of the tree serves all observers.
+  registryIt->second.recordMutations(
+      oldRootShadowNode, newRootShadowNode, mutationRecords);
 
   if (!mutationRecords.empty()) {
     onMutations_(mutationRecords);
@@ -12,6 +12,7 @@
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
 #include <vector>
 #include "MutationObserver.h"
+#include "MutationObserverRegistry.h"
 
 namespace facebook::react {
 
@@ -46,10 +47,8 @@ class MutationObserverManager final : public UIManagerCommitHook {
       const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
 
  private:
-  std::unordered_map<
-      SurfaceId,
-      std::unordered_map<MutationObserverId, MutationObserver>>
-      observersBySurfaceId_;
+  std::unordered_map<SurfaceId, MutationObserverRegistry>
+      registriesBySurfaceId_;
 
   std::function<void(std::vector<MutationRecord>&)> onMutations_;
   bool commitHookRegistered_{};
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "MutationObserverRegistry.h"
+
+#include <algorithm>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Matches the children of both lists by family. Calls `onMatch` for every
+ * pair (in the order of `oldChildren`) and collects the unmatched children.
+ */
+template <typename OnMatchT>
+void diffChildren(
+    const ShadowNode::ListOfShared& oldChildren,
+    const ShadowNode::ListOfShared& newChildren,
+    std::vector<ShadowNode::Shared>& addedShadowNodes,
+    std::vector<ShadowNode::Shared>& removedShadowNodes,
+    OnMatchT&& onMatch) {
+  // Most commits don't change the structure of the children they clone, so
+  // the common prefix is matched without any lookup.
+  size_t prefixSize = 0;
+  auto minSize = std::min(oldChildren.size(), newChildren.size());
+  while (prefixSize < minSize &&
+         ShadowNode::sameFamily(
+             *oldChildren[prefixSize], *newChildren[prefixSize])) {
+    onMatch(*oldChildren[prefixSize], *newChildren[prefixSize]);
+    prefixSize++;
+  }
+
+  if (prefixSize == oldChildren.size() && prefixSize == newChildren.size()) {
+    return;
+  }
+
+  auto oldIndexByFamily =
+      std::unordered_map<const ShadowNodeFamily*, size_t>{};
+  oldIndexByFamily.reserve(oldChildren.size() - prefixSize);
+  for (auto i = prefixSize; i < oldChildren.size(); i++) {
+    oldIndexByFamily.emplace(&oldChildren[i]->getFamily(), i);
+  }
+
+  auto matchedNewChildren =
+      std::vector<const ShadowNode*>(oldChildren.size(), nullptr);
+  for (auto i = prefixSize; i < newChildren.size(); i++) {
+    const auto& newChild = newChildren[i];
+    auto it = oldIndexByFamily.find(&newChild->getFamily());
+    if (it == oldIndexByFamily.end()) {
+      addedShadowNodes.push_back(newChild);
+    } else {
+      matchedNewChildren[it->second] = newChild.get();
+    }
+  }
+
+  for (auto i = prefixSize; i < oldChildren.size(); i++) {
+    if (matchedNewChildren[i] == nullptr) {
+      removedShadowNodes.push_back(oldChildren[i]);
+    } else {
+      onMatch(*oldChildren[i], *matchedNewChildren[i]);
+    }
+  }
+}
+
+} // namespace
+
+void MutationObserverRegistry::observe(
+    MutationObserverId mutationObserverId,
+    ShadowNode::Shared targetShadowNode,
+    bool observeSubtree) {
+  auto& observations = observationsByFamily_[&targetShadowNode->getFamily()];
+
+  for (auto& observation : observations) {
+    if (observation.mutationObserverId == mutationObserverId) {
+      observation.targetShadowNode = std::move(targetShadowNode);
+      observation.observeSubtree = observeSubtree;
+      return;
+    }
+  }
+
+  observations.push_back(Observation{
+      mutationObserverId, std::move(targetShadowNode), observeSubtree});
+}
+
+void MutationObserverRegistry::unobserve(
+    MutationObserverId mutationObserverId,
+    const ShadowNode& targetShadowNode) {
+  auto it = observationsByFamily_.find(&targetShadowNode.getFamily());
+  if (it == observationsByFamily_.end()) {
+    return;
+  }
+
+  auto& observations = it->second;
+  observations.erase(
+      std::remove_if(
+          observations.begin(),
+          observations.end(),
+          [&](const Observation& observation) {
+            return observation.mutationObserverId == mutationObserverId;
+          }),
+      observations.end());
+
+  if (observations.empty()) {
+    observationsByFamily_.erase(it);
+  }
+}
+
+bool MutationObserverRegistry::isEmpty() const {
+  return observationsByFamily_.empty();
+}
+
+void MutationObserverRegistry::recordMutations(
+    const RootShadowNode& oldRootShadowNode,
+    const RootShadowNode& newRootShadowNode,
+    std::vector<MutationRecord>& recordedMutations) const {
+  if (observationsByFamily_.empty()) {
+    return;
+  }
+
+  // Observations of the ancestors of the node being visited (and of the node
+  // itself) that include their subtree, outermost first.
+  auto subtreeObservations = std::vector<const Observation*>{};
+
+  recordMutationsInNode(
+      oldRootShadowNode,
+      newRootShadowNode,
+      subtreeObservations,
+      recordedMutations);
+}
+
+void MutationObserverRegistry::recordMutationsInNode(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode,
+    std::vector<const Observation*>& subtreeObservations,
+    std::vector<MutationRecord>& recordedMutations) const {
+  // If the nodes are referentially equal, their subtrees are also the same.
+  if (&oldShadowNode == &newShadowNode) {
+    return;
+  }
+
+  const Observations* nodeObservations = nullptr;
+  auto subtreeObservationsCount = subtreeObservations.size();
+
+  auto it = observationsByFamily_.find(&newShadowNode.getFamily());
+  if (it != observationsByFamily_.end()) {
+    nodeObservations = &it->second;
+    for (const auto& observation : it->second) {
+      if (observation.observeSubtree) {
+        subtreeObservations.push_back(&observation);
+      }
+    }
+  }
+
+  const auto& oldChildren = oldShadowNode.getChildren();
+  const auto& newChildren = newShadowNode.getChildren();
+
+  // Clones share the list of children of the original node unless the
+  // children were changed, so a shared list means the whole subtree is the
+  // same.
+  if (&oldChildren != &newChildren) {
+    auto addedShadowNodes = std::vector<ShadowNode::Shared>{};
+    auto removedShadowNodes = std::vector<ShadowNode::Shared>{};
+
+    diffChildren(
+        oldChildren,
+        newChildren,
+        addedShadowNodes,
+        removedShadowNodes,
+        [&](const ShadowNode& oldChild, const ShadowNode& newChild) {
+          recordMutationsInNode(
+              oldChild, newChild, subtreeObservations, recordedMutations);
+        });
+
+    if (!addedShadowNodes.empty() || !removedShadowNodes.empty()) {
+      recordMutationInNode(
+          nodeObservations,
+          subtreeObservations,
+          addedShadowNodes,
+          removedShadowNodes,
+          recordedMutations);
+    }
+  }
+
+  subtreeObservations.resize(subtreeObservationsCount);
+}
+
+void MutationObserverRegistry::recordMutationInNode(
+    const Observations* nodeObservations,
+    const std::vector<const Observation*>& subtreeObservations,
+    const std::vector<ShadowNode::Shared>& addedShadowNodes,
+    const std::vector<ShadowNode::Shared>& removedShadowNodes,
+    std::vector<MutationRecord>& recordedMutations) const {
+  auto recordedObserverIds = std::vector<MutationObserverId>{};
+
+  auto record = [&](const Observation& observation) {
+    if (std::find(
+            recordedObserverIds.begin(),
+            recordedObserverIds.end(),
+            observation.mutationObserverId) != recordedObserverIds.end()) {
+      return;
+    }
+
+    recordedObserverIds.push_back(observation.mutationObserverId);
+    recordedMutations.push_back(MutationRecord{
+        observation.mutationObserverId,
+        observation.targetShadowNode,
+        addedShadowNodes,
+        removedShadowNodes});
+  };
+
+  // Closest targets first: the node itself, then its observed ancestors.
+  if (nodeObservations != nullptr) {
+    for (const auto& observation : *nodeObservations) {
+      if (!observation.observeSubtree) {
+        record(observation);
+      }
+    }
+  }
+
+  for (auto it = subtreeObservations.rbegin(); it != subtreeObservations.rend();
+       ++it) {
+    record(**it);
+  }
+}
+
+} // namespace facebook::react
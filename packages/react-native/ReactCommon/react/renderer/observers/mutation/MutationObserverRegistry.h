@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <unordered_map>
+#include <vector>
+#include "MutationObserver.h"
+
+namespace facebook::react {
+
+/*
+ * Targets observed by all the mutation observers of a surface, indexed by
+ * family.
+ * Mutations are recorded from a single walk over the parts of the tree that
+ * changed in a commit, shared by all observers, so the cost of a commit is
+ * proportional to what changed rather than to the number of observed targets.
+ */
+class MutationObserverRegistry final {
+ public:
+  /*
+   * Observing a target again replaces the previous options.
+   */
+  void observe(
+      MutationObserverId mutationObserverId,
+      ShadowNode::Shared targetShadowNode,
+      bool observeSubtree);
+  void unobserve(
+      MutationObserverId mutationObserverId,
+      const ShadowNode& targetShadowNode);
+
+  bool isEmpty() const;
+
+  /*
+   * Records additions and removals of children in the observed targets (or
+   * in their subtrees, for targets observed with `observeSubtree`).
+   * A change is recorded at most once per observer, with the closest observed
+   * target as `targetShadowNode`. Targets that aren't present in both trees
+   * don't record anything.
+   */
+  void recordMutations(
+      const RootShadowNode& oldRootShadowNode,
+      const RootShadowNode& newRootShadowNode,
+      std::vector<MutationRecord>& recordedMutations) const;
+
+ private:
+  struct Observation {
+    MutationObserverId mutationObserverId;
+    ShadowNode::Shared targetShadowNode;
+    bool observeSubtree;
+  };
+
+  using Observations = std::vector<Observation>;
+
+  void recordMutationsInNode(
+      const ShadowNode& oldShadowNode,
+      const ShadowNode& newShadowNode,
+      std::vector<const Observation*>& subtreeObservations,
+      std::vector<MutationRecord>& recordedMutations) const;
+
+  void recordMutationInNode(
+      const Observations* nodeObservations,
+      const std::vector<const Observation*>& subtreeObservations,
+      const std::vector<ShadowNode::Shared>& addedShadowNodes,
+      const std::vector<ShadowNode::Shared>& removedShadowNodes,
+      std::vector<MutationRecord>& recordedMutations) const;
+
+  std::unordered_map<const ShadowNodeFamily*, Observations>
+      observationsByFamily_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/observers/mutation/MutationObserverRegistry.h>
+
+#include <react/test_utils/shadowTreeGeneration.h>
+
+namespace facebook::react {
+
+class MutationObserverRegistryTest : public ::testing::Test {
+ protected:
+  MutationObserverRegistryTest()
+      : contextContainer_(std::make_shared<ContextContainer>()),
+        rootComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            contextContainer_,
+            nullptr}),
+        viewComponentDescriptor_(ComponentDescriptorParameters{
+            EventDispatcher::Shared{},
+            contextContainer_,
+            nullptr}) {}
+
+  ShadowNode::Shared createNode(
+      Tag tag,
+      const ShadowNode::ListOfShared& children = {}) {
+    auto family =
+        viewComponentDescriptor_.createFamily({tag, SurfaceId(1), nullptr});
+    return viewComponentDescriptor_.createShadowNode(
+        ShadowNodeFragment{
+            generateDefaultProps(viewComponentDescriptor_),
+            std::make_shared<const ShadowNode::ListOfShared>(children)},
+        family);
+  }
+
+  RootShadowNode::Shared createRootNode(
+      const ShadowNode::ListOfShared& children) {
+    auto family =
+        rootComponentDescriptor_.createFamily({Tag(1), SurfaceId(1), nullptr});
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootComponentDescriptor_.createShadowNode(
+            ShadowNodeFragment{
+                RootShadowNode::defaultSharedProps(),
+                std::make_shared<const ShadowNode::ListOfShared>(children)},
+            family));
+  }
+
+  template <typename ShadowNodeT>
+  std::shared_ptr<const ShadowNodeT> cloneWithChildren(
+      const ShadowNodeT& shadowNode,
+      const ShadowNode::ListOfShared& children) {
+    // `RootShadowNode` hides the generic overload of `clone`.
+    const ShadowNode& node = shadowNode;
+    return std::static_pointer_cast<const ShadowNodeT>(
+        node.clone(ShadowNodeFragment{
+            ShadowNodeFragment::propsPlaceholder(),
+            std::make_shared<const ShadowNode::ListOfShared>(children)}));
+  }
+
+  std::shared_ptr<ContextContainer> contextContainer_;
+  RootComponentDescriptor rootComponentDescriptor_;
+  ViewComponentDescriptor viewComponentDescriptor_;
+  MutationObserverRegistry registry_;
+};
+
+TEST_F(MutationObserverRegistryTest, recordsAddedAndRemovedChildren) {
+  auto nodeB = createNode(3);
+  auto nodeC = createNode(4);
+  auto nodeD = createNode(5);
+  auto nodeA = createNode(2, {nodeB, nodeC});
+  auto oldRootNode = createRootNode({nodeA});
+
+  registry_.observe(1, nodeA, false);
+
+  auto newRootNode = cloneWithChildren(
+      *oldRootNode, {cloneWithChildren(*nodeA, {nodeC, nodeD})});
+
+  auto records = std::vector<MutationRecord>{};
+  registry_.recordMutations(*oldRootNode, *newRootNode, records);
+
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].mutationObserverId, 1);
+  EXPECT_EQ(records[0].targetShadowNode, nodeA);
+  EXPECT_EQ(records[0].addedShadowNodes, ShadowNode::ListOfShared{nodeD});
+  EXPECT_EQ(records[0].removedShadowNodes, ShadowNode::ListOfShared{nodeB});
+
+  // Reordering children isn't a mutation.
+  auto reorderedRootNode = cloneWithChildren(
+      *oldRootNode, {cloneWithChildren(*nodeA, {nodeC, nodeB})});
+
+  records.clear();
+  registry_.recordMutations(*oldRootNode, *reorderedRootNode, records);
+
+  EXPECT_TRUE(records.empty());
+}
+
+TEST_F(MutationObserverRegistryTest, observesSubtreesOnlyWhenRequested) {
+  auto nodeC = createNode(4);
+  auto nodeB = createNode(3, {nodeC});
+  auto nodeA = createNode(2, {nodeB});
+  auto oldRootNode = createRootNode({nodeA});
+
+  registry_.observe(1, nodeA, false);
+  registry_.observe(2, nodeA, true);
+
+  auto newNodeA = cloneWithChildren(*nodeA, {cloneWithChildren(*nodeB, {})});
+  auto newRootNode = cloneWithChildren(*oldRootNode, {newNodeA});
+
+  auto records = std::vector<MutationRecord>{};
+  registry_.recordMutations(*oldRootNode, *newRootNode, records);
+
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].mutationObserverId, 2);
+  EXPECT_EQ(records[0].targetShadowNode, nodeA);
+  EXPECT_TRUE(records[0].addedShadowNodes.empty());
+  EXPECT_EQ(records[0].removedShadowNodes, ShadowNode::ListOfShared{nodeC});
+}
+
+TEST_F(MutationObserverRegistryTest, recordsOncePerObserverForClosestTarget) {
+  auto nodeC = createNode(4);
+  auto nodeB = createNode(3, {nodeC});
+  auto nodeA = createNode(2, {nodeB});
+  auto oldRootNode = createRootNode({nodeA});
+
+  registry_.observe(1, nodeA, true);
+  registry_.observe(1, nodeB, true);
+  registry_.observe(2, nodeA, true);
+
+  auto newNodeA = cloneWithChildren(*nodeA, {cloneWithChildren(*nodeB, {})});
+  auto newRootNode = cloneWithChildren(*oldRootNode, {newNodeA});
+
+  auto records = std::vector<MutationRecord>{};
+  registry_.recordMutations(*oldRootNode, *newRootNode, records);
+
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].mutationObserverId, 1);
+  EXPECT_EQ(records[0].targetShadowNode, nodeB);
+  EXPECT_EQ(records[1].mutationObserverId, 2);
+  EXPECT_EQ(records[1].targetShadowNode, nodeA);
+}
+
+TEST_F(MutationObserverRegistryTest, skipsUnchangedSubtrees) {
+  auto nodeB = createNode(3);
+  auto nodeA = createNode(2, {nodeB});
+  auto nodeE = createNode(6);
+  auto oldRootNode = createRootNode({nodeA, nodeE});
+
+  registry_.observe(1, nodeA, true);
+
+  // Only the sibling of the target changed.
+  auto newRootNode = cloneWithChildren(
+      *oldRootNode, {nodeA, cloneWithChildren(*nodeE, {createNode(7)})});
+
+  auto records = std::vector<MutationRecord>{};
+  registry_.recordMutations(*oldRootNode, *newRootNode, records);
+
+  EXPECT_TRUE(records.empty());
+
+  // Removing the target itself isn't recorded in the target.
+  newRootNode = cloneWithChildren(*oldRootNode, {nodeE});
+  registry_.recordMutations(*oldRootNode, *newRootNode, records);
+
+  EXPECT_TRUE(records.empty());
+
+  registry_.unobserve(1, *nodeA);
+
+  EXPECT_TRUE(registry_.isEmpty());
+}
+
+} // namespace facebook::react
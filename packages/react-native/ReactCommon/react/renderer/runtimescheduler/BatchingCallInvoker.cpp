@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchingCallInvoker.h"
+
+#include <iterator>
+#include <utility>
+
+namespace facebook::react {
+
+BatchingCallInvoker::BatchingCallInvoker(
+    std::shared_ptr<CallInvoker> callInvoker)
+    : callInvoker_(std::move(callInvoker)) {}
+
+void BatchingCallInvoker::invokeAsync(CallFunc&& func) noexcept {
+  enqueue(0, std::move(func));
+}
+
+void BatchingCallInvoker::invokeAsync(
+    SchedulerPriority priority,
+    CallFunc&& func) noexcept {
+  enqueue(static_cast<size_t>(priority), std::move(func));
+}
+
+void BatchingCallInvoker::invokeSync(CallFunc&& func) {
+  callInvoker_->invokeSync(std::move(func));
+}
+
+void BatchingCallInvoker::enqueue(size_t laneIndex, CallFunc&& func) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lanes_[laneIndex].pending.push_back(std::move(func));
+  }
+  scheduleFlushIfNeeded(laneIndex);
+}
+
+void BatchingCallInvoker::scheduleFlushIfNeeded(size_t laneIndex) noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& lane = lanes_[laneIndex];
+    if (lane.isScheduled || lane.pending.empty()) {
+      return;
+    }
+    lane.isScheduled = true;
+  }
+
+  auto flushFunc = [weakThis = weak_from_this(),
+                    laneIndex](jsi::Runtime& runtime) {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->flush(laneIndex, runtime);
+    }
+  };
+
+  if (laneIndex == 0) {
+    callInvoker_->invokeAsync(std::move(flushFunc));
+  } else {
+    callInvoker_->invokeAsync(
+        static_cast<SchedulerPriority>(laneIndex), std::move(flushFunc));
+  }
+}
+
+void BatchingCallInvoker::flush(size_t laneIndex, jsi::Runtime& runtime) {
+  std::vector<CallFunc> batch;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& lane = lanes_[laneIndex];
+    // Calls arriving while the batch runs start a new batch.
+    batch.swap(lane.pending);
+    lane.isScheduled = false;
+  }
+
+  for (size_t index = 0; index < batch.size(); index++) {
+    try {
+      batch[index](runtime);
+    } catch (...) {
+      // Put the remaining calls back in front of the lane so one failing
+      // call doesn't drop the others, then let the error reach the caller.
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& pending = lanes_[laneIndex].pending;
+        pending.insert(
+            pending.begin(),
+            std::make_move_iterator(batch.begin() + index + 1),
+            std::make_move_iterator(batch.end()));
+      }
+      scheduleFlushIfNeeded(laneIndex);
+      throw;
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * CallInvoker decorator that coalesces asynchronous calls.
+ * The first call of a given priority schedules a single task on the wrapped
+ * invoker; every call of the same priority that arrives before that task runs
+ * is appended to it, so a burst of N resolutions enters JS once per priority
+ * instead of N times. Synchronous calls are forwarded as is.
+ */
+class BatchingCallInvoker
+    : public CallInvoker,
+      public std::enable_shared_from_this<BatchingCallInvoker> {
+ public:
+  explicit BatchingCallInvoker(std::shared_ptr<CallInvoker> callInvoker);
+
+  void invokeAsync(CallFunc&& func) noexcept override;
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override;
+  void invokeSync(CallFunc&& func) override;
+
+ private:
+  /*
+   * Lane 0 holds calls without an explicit priority, lanes 1-5 map to
+   * `SchedulerPriority` values.
+   */
+  static constexpr size_t kLaneCount = 6;
+
+  struct Lane {
+    std::vector<CallFunc> pending;
+    bool isScheduled{false};
+  };
+
+  void enqueue(size_t laneIndex, CallFunc&& func) noexcept;
+  void scheduleFlushIfNeeded(size_t laneIndex) noexcept;
+  void flush(size_t laneIndex, jsi::Runtime& runtime);
+
+  std::shared_ptr<CallInvoker> callInvoker_;
+  std::mutex mutex_;
+  std::array<Lane, kLaneCount> lanes_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "EventCausality.h"
+
+namespace facebook::react {
+
+namespace {
+
+thread_local EventCausalityId currentCausalityId = kNoEventCausality;
+thread_local int scopeDepth = 0;
+
+} // namespace
+
+EventCausalityId getCurrentEventCausalityId() {
+  return currentCausalityId;
+}
+
+void attributeCurrentScopeToEvent(EventCausalityId causalityId) {
+  if (scopeDepth > 0 && currentCausalityId == kNoEventCausality) {
+    currentCausalityId = causalityId;
+  }
+}
+
+ScopedEventCausality::ScopedEventCausality(EventCausalityId causalityId)
+    : previousCausalityId_(currentCausalityId) {
+  currentCausalityId = causalityId;
+  scopeDepth++;
+}
+
+ScopedEventCausality::~ScopedEventCausality() {
+  currentCausalityId = previousCausalityId_;
+  scopeDepth--;
+}
+
+} // namespace facebook::react
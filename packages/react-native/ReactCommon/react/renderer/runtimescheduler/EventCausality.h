@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/utils/EventCausalityId.h>
+
+namespace facebook::react {
+
+/*
+ * Returns the event the work currently running on this thread is
+ * attributed to, or `kNoEventCausality`.
+ */
+EventCausalityId getCurrentEventCausalityId();
+
+/*
+ * Attributes the rest of the innermost `ScopedEventCausality` to
+ * `causalityId`, unless it's already attributed to some event.
+ * Used when an event is dispatched in the middle of a task: the work the
+ * event handlers defer to the end of the task (e.g. microtasks flushing
+ * React updates) is caused by that event too.
+ * Does nothing outside of any `ScopedEventCausality`.
+ */
+void attributeCurrentScopeToEvent(EventCausalityId causalityId);
+
+/*
+ * Attributes the work done on this thread during the lifetime of the object
+ * to `causalityId`. Restores the previous attribution when destroyed.
+ */
+class ScopedEventCausality final {
+ public:
+  explicit ScopedEventCausality(EventCausalityId causalityId);
+  ~ScopedEventCausality();
+
+  /*
+   * Not copyable, not movable.
+   */
+  ScopedEventCausality(const ScopedEventCausality&) = delete;
+  ScopedEventCausality& operator=(const ScopedEventCausality&) = delete;
+
+ private:
+  EventCausalityId previousCausalityId_;
+};
+
+} // namespace facebook::react
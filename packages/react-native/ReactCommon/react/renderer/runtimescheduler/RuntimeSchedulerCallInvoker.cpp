@@ -6,6 +6,7 @@
  */
 
 #include "RuntimeSchedulerCallInvoker.h"
+#include "BatchingCallInvoker.h"
 #include "RuntimeScheduler.h"
 
 #include <utility>
@@ -39,4 +40,11 @@ void RuntimeSchedulerCallInvoker::invokeAsync(
   }
 }
 
+std::shared_ptr<CallInvoker> createBatchingRuntimeSchedulerCallInvoker(
+    std::weak_ptr<RuntimeScheduler> runtimeScheduler) {
+  return std::make_shared<BatchingCallInvoker>(
+      std::make_shared<RuntimeSchedulerCallInvoker>(
+          std::move(runtimeScheduler)));
+}
+
 } // namespace facebook::react
@@ -9,6 +9,8 @@
 
 #include <ReactCommon/CallInvoker.h>
 
+#include <memory>
+
 namespace facebook::react {
 
 class RuntimeScheduler;
@@ -33,4 +35,12 @@ class RuntimeSchedulerCallInvoker : public CallInvoker {
   std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
 };
 
+/*
+ * Creates the invoker native modules use to call into JavaScript: calls go
+ * through `RuntimeScheduler`, and asynchronous calls of the same priority are
+ * coalesced into one task by `BatchingCallInvoker`.
+ */
+std::shared_ptr<CallInvoker> createBatchingRuntimeSchedulerCallInvoker(
+    std::weak_ptr<RuntimeScheduler> runtimeScheduler);
+
 } // namespace facebook::react
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RuntimeSchedulerStallDetector.h"
+
+#include <string_view>
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+std::string_view toString(EventLoopStep step) {
+  switch (step) {
+    case EventLoopStep::Task:
+      return "task";
+    case EventLoopStep::Microtasks:
+      return "microtasks";
+    case EventLoopStep::RenderingUpdate:
+      return "rendering update";
+  }
+  return "";
+}
+
+std::string_view toString(RendererPhase rendererPhase) {
+  switch (rendererPhase) {
+    case RendererPhase::None:
+      return "";
+    case RendererPhase::Commit:
+      return "commit";
+    case RendererPhase::Layout:
+      return "layout";
+    case RendererPhase::TextMeasure:
+      return "text measure";
+    case RendererPhase::Diff:
+      return "diff";
+    case RendererPhase::Mount:
+      return "mount";
+  }
+  return "";
+}
+
+std::string_view toString(SchedulerPriority priority) {
+  switch (priority) {
+    case SchedulerPriority::ImmediatePriority:
+      return "immediate";
+    case SchedulerPriority::UserBlockingPriority:
+      return "user blocking";
+    case SchedulerPriority::NormalPriority:
+      return "normal";
+    case SchedulerPriority::LowPriority:
+      return "low";
+    case SchedulerPriority::IdlePriority:
+      return "idle";
+  }
+  return "";
+}
+
+} // namespace
+
+std::string RuntimeSchedulerStallReport::getName() const {
+  auto name = std::string{"Stall in "};
+  name += toString(step);
+  if (rendererPhase != RendererPhase::None) {
+    name += " (";
+    name += toString(rendererPhase);
+    name += ")";
+  }
+  name += ", ";
+  name += toString(priority);
+  name += " priority, ";
+  name += isJavaScriptCallback ? "JS callback" : "native callback";
+  return name;
+}
+
+#pragma mark - RuntimeSchedulerStallDetector::ScopedTask
+
+RuntimeSchedulerStallDetector::ScopedTask::ScopedTask(
+    RuntimeSchedulerStallDetector& stallDetector,
+    const TaskInfo& taskInfo,
+    RuntimeSchedulerTimePoint startTime)
+    : stallDetector_(stallDetector),
+      previousTask_(stallDetector.getRunningTask()),
+      previousRendererPhase_(stallDetector.rendererPhase_.exchange(
+          RendererPhase::None,
+          std::memory_order_relaxed)),
+      previousWatchedRendererPhase_(
+          setRendererPhaseWatcher(&stallDetector.rendererPhase_)) {
+  auto id = ++stallDetector_.lastTaskId_;
+  previousTaskReports_ = stallDetector_.runningTaskReports_.exchange(
+      id << kReportCountBits);
+  stallDetector_.setRunningTask(
+      RunningTask{.id = id, .info = taskInfo, .startTime = startTime});
+
+  // Sequentially consistent with the watchdog going idle, so either it sees
+  // the task or the task sees it idle.
+  if (stallDetector_.isWatchdogIdle_.load()) {
+    std::lock_guard lock(stallDetector_.mutex_);
+    stallDetector_.watchdogCondition_.notify_one();
+  }
+}
+
+RuntimeSchedulerStallDetector::ScopedTask::~ScopedTask() {
+  stallDetector_.setRunningTask(previousTask_);
+  stallDetector_.runningTaskReports_.store(previousTaskReports_);
+
+  stallDetector_.rendererPhase_.store(
+      previousRendererPhase_, std::memory_order_relaxed);
+  setRendererPhaseWatcher(previousWatchedRendererPhase_);
+}
+
+void RuntimeSchedulerStallDetector::ScopedTask::setStep(EventLoopStep step) {
+  stallDetector_.runningTaskStep_.store(step, std::memory_order_relaxed);
+}
+
+#pragma mark - RuntimeSchedulerStallDetector
+
+RuntimeSchedulerStallDetector::RuntimeSchedulerStallDetector(
+    std::function<RuntimeSchedulerTimePoint()> now,
+    RuntimeSchedulerDuration threshold,
+    OnStall onStall)
+    : now_(std::move(now)),
+      threshold_(threshold),
+      onStall_(std::move(onStall)) {}
+
+RuntimeSchedulerStallDetector::~RuntimeSchedulerStallDetector() {
+  {
+    std::lock_guard lock(mutex_);
+    isWatchdogStopped_ = true;
+  }
+  watchdogCondition_.notify_all();
+
+  if (watchdogThread_.joinable()) {
+    watchdogThread_.join();
+  }
+}
+
+void RuntimeSchedulerStallDetector::startWatchdog() {
+  if (!watchdogThread_.joinable()) {
+    watchdogThread_ = std::thread([this]() { runWatchdog(); });
+  }
+}
+
+void RuntimeSchedulerStallDetector::sample() {
+  auto runningTask = readRunningTask();
+  if (!runningTask) {
+    return;
+  }
+
+  auto reports = runningTaskReports_.load();
+  auto reportCount = reports & ((uint64_t{1} << kReportCountBits) - 1);
+  if ((reports >> kReportCountBits) != runningTask->id ||
+      reportCount >= kMaxReportsPerTask) {
+    return;
+  }
+
+  auto sampleTime = now_();
+  auto blockedTime = sampleTime - runningTask->startTime;
+  if (blockedTime < threshold_ * static_cast<int>(reportCount + 1)) {
+    return;
+  }
+
+  // Fails if the task finished (or another one started) in the meantime.
+  if (!runningTaskReports_.compare_exchange_strong(reports, reports + 1)) {
+    return;
+  }
+
+  auto report = RuntimeSchedulerStallReport{
+      .taskScheduledTime = runningTask->info.scheduledTime,
+      .taskStartTime = runningTask->startTime,
+      .sampleTime = sampleTime,
+      .priority = runningTask->info.priority,
+      .isJavaScriptCallback = runningTask->info.isJavaScriptCallback,
+      .causalityId = runningTask->info.causalityId,
+      .step = runningTask->step,
+      .rendererPhase = rendererPhase_.load(std::memory_order_relaxed)};
+
+  {
+    std::lock_guard lock(pendingReportsMutex_);
+    pendingReports_.push_back(report);
+    hasPendingReports_.store(true, std::memory_order_release);
+  }
+
+  if (onStall_) {
+    onStall_(report);
+  }
+}
+
+std::vector<RuntimeSchedulerStallReport>
+RuntimeSchedulerStallDetector::popReports() {
+  if (!hasPendingReports_.load(std::memory_order_acquire)) {
+    return {};
+  }
+
+  std::lock_guard lock(pendingReportsMutex_);
+  hasPendingReports_.store(false, std::memory_order_relaxed);
+  return std::exchange(pendingReports_, {});
+}
+
+void RuntimeSchedulerStallDetector::setRunningTask(
+    const RunningTask& runningTask) {
+  auto sequence = runningTaskSequence_.load(std::memory_order_relaxed);
+  runningTaskSequence_.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  runningTaskId_.store(runningTask.id, std::memory_order_relaxed);
+  runningTaskScheduledTime_.store(
+      runningTask.info.scheduledTime, std::memory_order_relaxed);
+  runningTaskPriority_.store(
+      runningTask.info.priority, std::memory_order_relaxed);
+  runningTaskIsJavaScriptCallback_.store(
+      runningTask.info.isJavaScriptCallback, std::memory_order_relaxed);
+  runningTaskCausalityId_.store(
+      runningTask.info.causalityId, std::memory_order_relaxed);
+  runningTaskStartTime_.store(
+      runningTask.startTime, std::memory_order_relaxed);
+  runningTaskStep_.store(runningTask.step, std::memory_order_relaxed);
+
+  runningTaskSequence_.store(sequence + 2, std::memory_order_release);
+}
+
+RuntimeSchedulerStallDetector::RunningTask
+RuntimeSchedulerStallDetector::getRunningTask() const {
+  // Only the thread running the tasks writes the fields, so it doesn't need
+  // to check the sequence.
+  return RunningTask{
+      .id = runningTaskId_.load(std::memory_order_relaxed),
+      .info =
+          TaskInfo{
+              .scheduledTime =
+                  runningTaskScheduledTime_.load(std::memory_order_relaxed),
+              .priority = runningTaskPriority_.load(std::memory_order_relaxed),
+              .isJavaScriptCallback = runningTaskIsJavaScriptCallback_.load(
+                  std::memory_order_relaxed),
+              .causalityId =
+                  runningTaskCausalityId_.load(std::memory_order_relaxed)},
+      .startTime = runningTaskStartTime_.load(std::memory_order_relaxed),
+      .step = runningTaskStep_.load(std::memory_order_relaxed)};
+}
+
+std::optional<RuntimeSchedulerStallDetector::RunningTask>
+RuntimeSchedulerStallDetector::readRunningTask() const {
+  auto sequence = runningTaskSequence_.load(std::memory_order_acquire);
+  if (sequence % 2 != 0) {
+    return std::nullopt;
+  }
+
+  auto runningTask = getRunningTask();
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (runningTaskSequence_.load(std::memory_order_relaxed) != sequence ||
+      runningTask.id == 0) {
+    return std::nullopt;
+  }
+  return runningTask;
+}
+
+bool RuntimeSchedulerStallDetector::hasRunningTask() const {
+  return (runningTaskReports_.load() >> kReportCountBits) != 0;
+}
+
+void RuntimeSchedulerStallDetector::runWatchdog() {
+  // Sampling a few times per threshold bounds how late stalls are detected
+  // without keeping the thread busy.
+  auto samplingInterval = threshold_ / 4;
+
+  std::unique_lock lock(mutex_);
+  while (!isWatchdogStopped_) {
+    if (!hasRunningTask()) {
+      // Nothing can stall: sleep until a task starts, so idle apps don't
+      // wake the thread up.
+      isWatchdogIdle_.store(true);
+      watchdogCondition_.wait(lock, [this]() {
+        return isWatchdogStopped_ || hasRunningTask();
+      });
+      isWatchdogIdle_.store(false, std::memory_order_relaxed);
+      continue;
+    }
+
+    if (watchdogCondition_.wait_for(lock, samplingInterval, [this]() {
+          return isWatchdogStopped_;
+        })) {
+      break;
+    }
+
+    lock.unlock();
+    sample();
+    lock.lock();
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/SchedulerPriority.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/utils/RendererPhase.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Step of the event loop a task is in.
+ */
+enum class EventLoopStep : uint8_t {
+  Task,
+  Microtasks,
+  RenderingUpdate,
+};
+
+/*
+ * What the JavaScript thread was doing when it had been blocked for longer
+ * than the threshold of the `RuntimeSchedulerStallDetector`.
+ */
+struct RuntimeSchedulerStallReport {
+  // When the task was scheduled and started running.
+  RuntimeSchedulerTimePoint taskScheduledTime;
+  RuntimeSchedulerTimePoint taskStartTime;
+
+  // When the thread was found blocked (so the stall lasted at least
+  // `sampleTime - taskStartTime`).
+  RuntimeSchedulerTimePoint sampleTime;
+
+  SchedulerPriority priority;
+
+  // Whether the task runs a JavaScript function (as opposed to a native
+  // callback accessing the runtime).
+  bool isJavaScriptCallback;
+
+  // The input event the task is attributed to, if any.
+  EventCausalityId causalityId;
+
+  EventLoopStep step;
+  RendererPhase rendererPhase;
+
+  /*
+   * Short description of the report (without times), e.g.
+   * "Stall in microtasks (layout), normal priority, JS callback".
+   * There is a bounded number of distinct names.
+   */
+  std::string getName() const;
+};
+
+/*
+ * Watches the tasks run by the `RuntimeScheduler` from a separate thread and
+ * reports the ones that block the JavaScript thread for longer than a
+ * threshold while they are still running, along with the step of the event
+ * loop and the phase of the rendering pipeline they were in at that moment.
+ * A task that stays blocked is reported again every time it exceeds another
+ * multiple of the threshold, up to `kMaxReportsPerTask` times.
+ */
+class RuntimeSchedulerStallDetector final {
+ public:
+  using OnStall = std::function<void(const RuntimeSchedulerStallReport&)>;
+
+  static constexpr size_t kMaxReportsPerTask = 8;
+
+  /*
+   * `onStall` is called on the watchdog thread (or on the thread calling
+   * `sample`).
+   */
+  RuntimeSchedulerStallDetector(
+      std::function<RuntimeSchedulerTimePoint()> now,
+      RuntimeSchedulerDuration threshold,
+      OnStall onStall);
+
+  ~RuntimeSchedulerStallDetector();
+
+  /*
+   * Not copyable, not movable.
+   */
+  RuntimeSchedulerStallDetector(const RuntimeSchedulerStallDetector&) = delete;
+  RuntimeSchedulerStallDetector& operator=(
+      const RuntimeSchedulerStallDetector&) = delete;
+
+  struct TaskInfo {
+    RuntimeSchedulerTimePoint scheduledTime;
+    SchedulerPriority priority;
+    bool isJavaScriptCallback;
+    EventCausalityId causalityId;
+  };
+
+ private:
+  struct RunningTask {
+    // 0 if no task is running.
+    uint64_t id{0};
+    TaskInfo info{};
+    RuntimeSchedulerTimePoint startTime{};
+    EventLoopStep step{EventLoopStep::Task};
+  };
+
+ public:
+  /*
+   * Marks the task as running on the current thread during the lifetime of
+   * the object. Restores the task that was running before (for tasks run
+   * synchronously from other tasks) when destroyed.
+   * Doesn't lock: the running task is published to the watchdog through
+   * atomics.
+   */
+  class ScopedTask final {
+   public:
+    ScopedTask(
+        RuntimeSchedulerStallDetector& stallDetector,
+        const TaskInfo& taskInfo,
+        RuntimeSchedulerTimePoint startTime);
+    ~ScopedTask();
+
+    /*
+     * Not copyable, not movable.
+     */
+    ScopedTask(const ScopedTask&) = delete;
+    ScopedTask& operator=(const ScopedTask&) = delete;
+
+    void setStep(EventLoopStep step);
+
+   private:
+    RuntimeSchedulerStallDetector& stallDetector_;
+    RunningTask previousTask_;
+    uint64_t previousTaskReports_;
+    RendererPhase previousRendererPhase_;
+    std::atomic<RendererPhase>* previousWatchedRendererPhase_;
+  };
+
+  /*
+   * Starts a thread that samples the running task periodically, until the
+   * detector is destroyed. The thread sleeps while no task is running.
+   */
+  void startWatchdog();
+
+  /*
+   * Checks whether the running task exceeded the threshold (again) and
+   * reports it. Called by the watchdog thread.
+   */
+  void sample();
+
+  /*
+   * Returns the reports emitted since the last call, so they can be logged
+   * on the JavaScript thread. Doesn't lock unless there are any.
+   */
+  std::vector<RuntimeSchedulerStallReport> popReports();
+
+ private:
+  void runWatchdog();
+
+  // Called by the thread running the tasks.
+  void setRunningTask(const RunningTask& runningTask);
+  RunningTask getRunningTask() const;
+
+  // Called by the watchdog. Returns `std::nullopt` if no task is running, or
+  // if the running task changed while it was being read.
+  std::optional<RunningTask> readRunningTask() const;
+
+  bool hasRunningTask() const;
+
+  const std::function<RuntimeSchedulerTimePoint()> now_;
+  const RuntimeSchedulerDuration threshold_;
+  const OnStall onStall_;
+
+  // Updated by the thread running the tasks as it goes through the
+  // rendering pipeline.
+  std::atomic<RendererPhase> rendererPhase_{RendererPhase::None};
+
+  // The task that is running. Only written by the thread running the tasks,
+  // and read by the watchdog as a seqlock: `runningTaskSequence_` is odd
+  // while the fields are being written.
+  std::atomic<uint32_t> runningTaskSequence_{0};
+  std::atomic<uint64_t> runningTaskId_{0};
+  std::atomic<RuntimeSchedulerTimePoint> runningTaskScheduledTime_{};
+  std::atomic<SchedulerPriority> runningTaskPriority_{
+      SchedulerPriority::NormalPriority};
+  std::atomic<bool> runningTaskIsJavaScriptCallback_{false};
+  std::atomic<EventCausalityId> runningTaskCausalityId_{kNoEventCausality};
+  std::atomic<RuntimeSchedulerTimePoint> runningTaskStartTime_{};
+  std::atomic<EventLoopStep> runningTaskStep_{EventLoopStep::Task};
+
+  // ID of the running task (0 if none) in the upper bits, and number of
+  // times it was reported in the lower `kReportCountBits`. Incremented by the
+  // watchdog only while the ID is unchanged.
+  static constexpr int kReportCountBits = 8;
+  static_assert(kMaxReportsPerTask < (1 << kReportCountBits));
+  std::atomic<uint64_t> runningTaskReports_{0};
+  uint64_t lastTaskId_{0}; // Only used by the thread running the tasks.
+
+  std::mutex pendingReportsMutex_;
+  std::vector<RuntimeSchedulerStallReport> pendingReports_;
+  std::atomic<bool> hasPendingReports_{false};
+
+  std::mutex mutex_;
+
+  // Notified when a task starts while the watchdog is idle, and when the
+  // detector is destroyed. Waited on with `mutex_`.
+  std::condition_variable watchdogCondition_;
+  std::atomic<bool> isWatchdogIdle_{false};
+  bool isWatchdogStopped_{false}; // Protected by `mutex_`.
+  std::thread watchdogThread_;
+};
+
+} // namespace facebook::react
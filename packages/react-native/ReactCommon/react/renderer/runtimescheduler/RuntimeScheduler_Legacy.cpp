@@ -255,6 +255,7 @@ void RuntimeScheduler_Legacy::executeTask(
   {
     ScopedShadowTreeRevisionLock revisionLock(
         shadowTreeRevisionConsistencyManager_);
+    ScopedEventCausality causality(task->causalityId);
 
     auto result = task->execute(runtime, didUserCallbackTimeout);
 
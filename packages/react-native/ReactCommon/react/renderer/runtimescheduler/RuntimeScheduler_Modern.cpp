@@ -13,7 +13,11 @@
 #include <react/renderer/consistency/ScopedShadowTreeRevisionLock.h>
 #include <react/timing/primitives.h>
 #include <react/utils/OnScopeExit.h>
+#include <reactperflogger/fusebox/FuseboxTracer.h>
+#include <optional>
+#include <string_view>
 #include <utility>
+#include <variant>
 
 namespace facebook::react {
 
@@ -26,6 +30,9 @@ std::chrono::milliseconds getResolvedTimeoutForIdleTask(
           customTimeout
       : customTimeout;
 }
+
+// Track of the stall reports in Fusebox traces.
+constexpr std::string_view kStallTrack = "RuntimeScheduler: Stalls";
 } // namespace
 
 #pragma mark - Public
@@ -53,9 +60,11 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "callbackType",
       "jsi::Function");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -72,9 +81,11 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleTask(
       "callbackType",
       "RawCallback");
 
-  auto expirationTime = now_() + timeoutForSchedulerPriority(priority);
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   auto task =
       std::make_shared<Task>(priority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -92,9 +103,11 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
       "jsi::Function");
 
   auto timeout = getResolvedTimeoutForIdleTask(customTimeout);
-  auto expirationTime = now_() + timeout;
+  auto currentTime = now_();
+  auto expirationTime = currentTime + timeout;
   auto task = std::make_shared<Task>(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -111,9 +124,12 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
       "callbackType",
       "RawCallback");
 
-  auto expirationTime = now_() + getResolvedTimeoutForIdleTask(customTimeout);
+  auto currentTime = now_();
+  auto expirationTime =
+      currentTime + getResolvedTimeoutForIdleTask(customTimeout);
   auto task = std::make_shared<Task>(
       SchedulerPriority::IdlePriority, std::move(callback), expirationTime);
+  task->scheduledTime = currentTime;
 
   scheduleTask(task);
 
@@ -154,6 +170,7 @@ void RuntimeScheduler_Modern::executeNowOnTheSameThread(
   auto priority = SchedulerPriority::ImmediatePriority;
   auto expirationTime = currentTime + timeoutForSchedulerPriority(priority);
   Task task{priority, std::move(callback), expirationTime};
+  task.scheduledTime = currentTime;
 
   if (runtimePtr == nullptr) {
     syncTaskRequests_++;
@@ -229,6 +246,25 @@ void RuntimeScheduler_Modern::setShadowTreeRevisionConsistencyManager(
 void RuntimeScheduler_Modern::setPerformanceEntryReporter(
     PerformanceEntryReporter* performanceEntryReporter) {
   performanceEntryReporter_ = performanceEntryReporter;
+
+  if (performanceEntryReporter_ != nullptr && stallDetector_ == nullptr &&
+      ReactNativeFeatureFlags::enableLongTaskAPI()) {
+    // Reports are traced as soon as they are detected (in case the thread
+    // never recovers), and added to the performance timeline as "stall"
+    // entries at the end of the task.
+    stallDetector_ = std::make_unique<RuntimeSchedulerStallDetector>(
+        now_,
+        std::chrono::milliseconds(
+            static_cast<int64_t>(LONG_TASK_DURATION_THRESHOLD_MS)),
+        [](const RuntimeSchedulerStallReport& report) {
+          FuseboxTracer::getFuseboxTracer().addEvent(
+              report.getName(),
+              report.taskStartTime,
+              report.sampleTime,
+              kStallTrack);
+        });
+    stallDetector_->startWatchdog();
+  }
 }
 
 void RuntimeScheduler_Modern::setEventTimingDelegate(
@@ -325,9 +361,27 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   ScopedShadowTreeRevisionLock revisionLock(
       shadowTreeRevisionConsistencyManager_);
 
+  // Covers microtasks and rendering updates too, so commits made at the end
+  // of the task are attributed to the event that caused it.
+  ScopedEventCausality causality(task.causalityId);
+
   currentTask_ = &task;
   currentPriority_ = task.priority;
 
+  auto stallDetectorTask =
+      std::optional<RuntimeSchedulerStallDetector::ScopedTask>{};
+  if (stallDetector_ != nullptr) {
+    stallDetectorTask.emplace(
+        *stallDetector_,
+        RuntimeSchedulerStallDetector::TaskInfo{
+            .scheduledTime = task.scheduledTime,
+            .priority = task.priority,
+            .isJavaScriptCallback = task.callback.has_value() &&
+                std::holds_alternative<jsi::Function>(*task.callback),
+            .causalityId = task.causalityId},
+        taskStartTime);
+  }
+
   if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
     lastYieldingOpportunity_ = taskStartTime;
     longestPeriodWithoutYieldingOpportunity_ =
@@ -339,6 +393,9 @@ void RuntimeScheduler_Modern::runEventLoopTick(
 
   if (ReactNativeFeatureFlags::enableMicrotasks()) {
     // "Perform a microtask checkpoint" step.
+    if (stallDetectorTask) {
+      stallDetectorTask->setStep(EventLoopStep::Microtasks);
+    }
     performMicrotaskCheckpoint(runtime);
   }
 
@@ -350,9 +407,17 @@ void RuntimeScheduler_Modern::runEventLoopTick(
 
   if (ReactNativeFeatureFlags::batchRenderingUpdatesInEventLoop()) {
     // "Update the rendering" step.
+    if (stallDetectorTask) {
+      stallDetectorTask->setStep(EventLoopStep::RenderingUpdate);
+    }
     updateRendering();
   }
 
+  if (stallDetectorTask) {
+    stallDetectorTask.reset();
+    reportStalls();
+  }
+
   currentTask_ = nullptr;
 }
 
@@ -463,6 +528,20 @@ void RuntimeScheduler_Modern::reportLongTasks(
   }
 }
 
+void RuntimeScheduler_Modern::reportStalls() {
+  auto reports = stallDetector_->popReports();
+  if (reports.empty() || performanceEntryReporter_ == nullptr) {
+    return;
+  }
+
+  for (const auto& report : reports) {
+    performanceEntryReporter_->logStallEntry(
+        report.getName(),
+        chronoToDOMHighResTimeStamp(report.taskStartTime),
+        chronoToDOMHighResTimeStamp(report.sampleTime - report.taskStartTime));
+  }
+}
+
 void RuntimeScheduler_Modern::markYieldingOpportunity(
     RuntimeSchedulerTimePoint currentTime) {
   auto currentPeriod = currentTime - lastYieldingOpportunity_;
@@ -11,6 +11,7 @@
 #include <react/renderer/consistency/ShadowTreeRevisionConsistencyManager.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerStallDetector.h>
 #include <react/renderer/runtimescheduler/Task.h>
 #include <atomic>
 #include <memory>
@@ -210,6 +211,8 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
       RuntimeSchedulerTimePoint startTime,
       RuntimeSchedulerTimePoint endTime);
 
+  void reportStalls();
+
   /*
    * Returns a time point representing the current point in time. May be called
    * from multiple threads.
@@ -229,6 +232,11 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
       nullptr};
 
   PerformanceEntryReporter* performanceEntryReporter_{nullptr};
+
+  // Samples the tasks that block the thread for longer than the long task
+  // threshold. Only set if long tasks are reported.
+  std::unique_ptr<RuntimeSchedulerStallDetector> stallDetector_;
+
   RuntimeSchedulerEventTimingDelegate* eventTimingDelegate_{nullptr};
 
   RuntimeSchedulerTaskErrorHandler onTaskError_;
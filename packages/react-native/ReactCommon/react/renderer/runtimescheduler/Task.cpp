@@ -15,7 +15,8 @@ Task::Task(
     std::chrono::steady_clock::time_point expirationTime)
     : priority(priority),
       callback(std::move(callback)),
-      expirationTime(expirationTime) {}
+      expirationTime(expirationTime),
+      causalityId(getCurrentEventCausalityId()) {}
 
 Task::Task(
     SchedulerPriority priority,
@@ -23,7 +24,8 @@ Task::Task(
     std::chrono::steady_clock::time_point expirationTime)
     : priority(priority),
       callback(std::move(callback)),
-      expirationTime(expirationTime) {}
+      expirationTime(expirationTime),
+      causalityId(getCurrentEventCausalityId()) {}
 
 jsi::Value Task::execute(jsi::Runtime& runtime, bool didUserCallbackTimeout) {
   auto result = jsi::Value::undefined();
@@ -9,6 +9,7 @@
 
 #include <ReactCommon/SchedulerPriority.h>
 #include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerClock.h>
 
 #include <optional>
@@ -42,6 +43,14 @@ struct Task final : public jsi::NativeState {
   std::optional<std::variant<jsi::Function, RawCallback>> callback;
   RuntimeSchedulerClock::time_point expirationTime;
 
+  // When the task was added to the queue (only set by
+  // `RuntimeScheduler_Modern`).
+  RuntimeSchedulerClock::time_point scheduledTime;
+
+  // The event that was being processed when the task was scheduled, if any.
+  // Tasks scheduled while the task runs inherit it.
+  EventCausalityId causalityId;
+
   jsi::Value execute(jsi::Runtime& runtime, bool didUserCallbackTimeout);
 };
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/BatchingCallInvoker.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "StubClock.h"
+#include "StubQueue.h"
+
+namespace facebook::react {
+
+class StubCallInvoker : public CallInvoker {
+ public:
+  void invokeAsync(CallFunc&& func) noexcept override {
+    queue.emplace_back(std::nullopt, std::move(func));
+  }
+
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override {
+    queue.emplace_back(priority, std::move(func));
+  }
+
+  void invokeSync(CallFunc&& /*func*/) override {
+    syncCallCount++;
+  }
+
+  std::list<std::pair<std::optional<SchedulerPriority>, CallFunc>> queue;
+  int syncCallCount{0};
+};
+
+class BatchingCallInvokerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    stubCallInvoker_ = std::make_shared<StubCallInvoker>();
+    callInvoker_ = std::make_shared<BatchingCallInvoker>(stubCallInvoker_);
+  }
+
+  void flush() {
+    while (!stubCallInvoker_->queue.empty()) {
+      auto func = std::move(stubCallInvoker_->queue.front().second);
+      stubCallInvoker_->queue.pop_front();
+      func(*runtime_);
+    }
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<StubCallInvoker> stubCallInvoker_;
+  std::shared_ptr<BatchingCallInvoker> callInvoker_;
+};
+
+TEST_F(BatchingCallInvokerTest, coalescesCallsOfTheSamePriority) {
+  std::vector<int> calls;
+
+  for (int i = 0; i < 200; i++) {
+    callInvoker_->invokeAsync(
+        SchedulerPriority::NormalPriority,
+        [&calls, i](jsi::Runtime&) { calls.push_back(i); });
+  }
+
+  EXPECT_EQ(stubCallInvoker_->queue.size(), 1);
+  EXPECT_EQ(
+      stubCallInvoker_->queue.front().first, SchedulerPriority::NormalPriority);
+
+  flush();
+
+  ASSERT_EQ(calls.size(), 200);
+  for (int i = 0; i < 200; i++) {
+    EXPECT_EQ(calls[i], i);
+  }
+}
+
+TEST_F(BatchingCallInvokerTest, keepsOneBatchPerPriority) {
+  std::vector<int> calls;
+
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { calls.push_back(0); });
+  callInvoker_->invokeAsync(SchedulerPriority::LowPriority, [&](jsi::Runtime&) {
+    calls.push_back(1);
+  });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority,
+      [&](jsi::Runtime&) { calls.push_back(2); });
+  callInvoker_->invokeAsync(SchedulerPriority::LowPriority, [&](jsi::Runtime&) {
+    calls.push_back(3);
+  });
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { calls.push_back(4); });
+
+  EXPECT_EQ(stubCallInvoker_->queue.size(), 3);
+
+  flush();
+
+  EXPECT_EQ(calls, std::vector<int>({0, 4, 1, 3, 2}));
+}
+
+TEST_F(BatchingCallInvokerTest, callsScheduledDuringFlushStartNewBatch) {
+  int callCount = 0;
+
+  callInvoker_->invokeAsync([&](jsi::Runtime&) {
+    callCount++;
+    callInvoker_->invokeAsync([&](jsi::Runtime&) { callCount++; });
+  });
+
+  EXPECT_EQ(stubCallInvoker_->queue.size(), 1);
+  auto func = std::move(stubCallInvoker_->queue.front().second);
+  stubCallInvoker_->queue.pop_front();
+  func(*runtime_);
+
+  EXPECT_EQ(callCount, 1);
+  EXPECT_EQ(stubCallInvoker_->queue.size(), 1);
+
+  flush();
+
+  EXPECT_EQ(callCount, 2);
+}
+
+TEST_F(BatchingCallInvokerTest, failingCallDoesNotDropTheRestOfTheBatch) {
+  std::vector<int> calls;
+
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { calls.push_back(0); });
+  callInvoker_->invokeAsync(
+      [&](jsi::Runtime&) { throw std::runtime_error("failure"); });
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { calls.push_back(2); });
+
+  EXPECT_THROW(flush(), std::runtime_error);
+  EXPECT_EQ(calls, std::vector<int>({0}));
+
+  flush();
+
+  EXPECT_EQ(calls, std::vector<int>({0, 2}));
+}
+
+TEST_F(BatchingCallInvokerTest, forwardsSyncCalls) {
+  callInvoker_->invokeSync([](jsi::Runtime&) {});
+
+  EXPECT_EQ(stubCallInvoker_->syncCallCount, 1);
+  EXPECT_TRUE(stubCallInvoker_->queue.empty());
+}
+
+TEST_F(BatchingCallInvokerTest, coalescesCallsOnTheRuntimeScheduler) {
+  // Same composition as the invoker given to TurboModules.
+  auto stubQueue = StubQueue{};
+  auto stubClock = StubClock{};
+  auto runtimeScheduler = std::make_shared<RuntimeScheduler>(
+      [&](std::function<void(jsi::Runtime&)>&& callback) {
+        stubQueue.runOnQueue([&, callback = std::move(callback)]() {
+          callback(*runtime_);
+        });
+      },
+      [&]() { return stubClock.getNow(); });
+  auto callInvoker =
+      createBatchingRuntimeSchedulerCallInvoker(runtimeScheduler);
+
+  std::vector<int> calls;
+  callInvoker->invokeAsync(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.push_back(0); });
+  stubClock.advanceTimeBy(std::chrono::milliseconds(1));
+  runtimeScheduler->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.push_back(1); });
+  stubClock.advanceTimeBy(std::chrono::milliseconds(1));
+  // Joins the task scheduled for the first call, so it runs before the task
+  // scheduled in between.
+  callInvoker->invokeAsync(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.push_back(2); });
+
+  stubQueue.flush();
+
+  EXPECT_EQ(calls, std::vector<int>({0, 2, 1}));
+}
+
+} // namespace facebook::react
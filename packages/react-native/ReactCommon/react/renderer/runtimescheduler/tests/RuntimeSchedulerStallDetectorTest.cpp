@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerStallDetector.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "StubClock.h"
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+class RuntimeSchedulerStallDetectorTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    stubClock_ = std::make_unique<StubClock>();
+    stubClock_->setTimePoint(1000ms);
+
+    stallDetector_ = std::make_unique<RuntimeSchedulerStallDetector>(
+        [this]() { return stubClock_->getNow(); },
+        50ms,
+        [this](const RuntimeSchedulerStallReport& report) {
+          reports_.push_back(report);
+        });
+  }
+
+  RuntimeSchedulerStallDetector::TaskInfo createTaskInfo(
+      SchedulerPriority priority = SchedulerPriority::NormalPriority) {
+    return RuntimeSchedulerStallDetector::TaskInfo{
+        .scheduledTime = stubClock_->getNow() - 10ms,
+        .priority = priority,
+        .isJavaScriptCallback = true,
+        .causalityId = 42};
+  }
+
+  std::unique_ptr<StubClock> stubClock_;
+  std::unique_ptr<RuntimeSchedulerStallDetector> stallDetector_;
+  std::vector<RuntimeSchedulerStallReport> reports_;
+};
+
+TEST_F(RuntimeSchedulerStallDetectorTest, doesNotReportShortTasks) {
+  {
+    auto task = RuntimeSchedulerStallDetector::ScopedTask{
+        *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+
+    stubClock_->advanceTimeBy(49ms);
+    stallDetector_->sample();
+  }
+
+  stubClock_->advanceTimeBy(100ms);
+  stallDetector_->sample();
+
+  EXPECT_TRUE(reports_.empty());
+  EXPECT_TRUE(stallDetector_->popReports().empty());
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, reportsWhatTheTaskWasDoing) {
+  auto taskInfo = createTaskInfo(SchedulerPriority::UserBlockingPriority);
+  auto startTime = stubClock_->getNow();
+
+  auto task = RuntimeSchedulerStallDetector::ScopedTask{
+      *stallDetector_, taskInfo, startTime};
+  task.setStep(EventLoopStep::Microtasks);
+  setCurrentRendererPhase(RendererPhase::Commit);
+  setCurrentRendererPhase(RendererPhase::Layout);
+
+  stubClock_->advanceTimeBy(60ms);
+  stallDetector_->sample();
+
+  ASSERT_EQ(reports_.size(), 1);
+  const auto& report = reports_[0];
+  EXPECT_EQ(report.taskScheduledTime, taskInfo.scheduledTime);
+  EXPECT_EQ(report.taskStartTime, startTime);
+  EXPECT_EQ(report.sampleTime, startTime + 60ms);
+  EXPECT_EQ(report.priority, SchedulerPriority::UserBlockingPriority);
+  EXPECT_TRUE(report.isJavaScriptCallback);
+  EXPECT_EQ(report.causalityId, 42);
+  EXPECT_EQ(report.step, EventLoopStep::Microtasks);
+  EXPECT_EQ(report.rendererPhase, RendererPhase::Layout);
+  EXPECT_EQ(
+      report.getName(),
+      "Stall in microtasks (layout), user blocking priority, JS callback");
+
+  // Reports are kept until they are popped.
+  EXPECT_EQ(stallDetector_->popReports().size(), 1);
+  EXPECT_TRUE(stallDetector_->popReports().empty());
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, reportsOncePerThreshold) {
+  auto task = RuntimeSchedulerStallDetector::ScopedTask{
+      *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+
+  stubClock_->advanceTimeBy(60ms);
+  stallDetector_->sample();
+  stallDetector_->sample();
+  EXPECT_EQ(reports_.size(), 1);
+
+  setCurrentRendererPhase(RendererPhase::Diff);
+  stubClock_->advanceTimeBy(50ms);
+  stallDetector_->sample();
+  ASSERT_EQ(reports_.size(), 2);
+  EXPECT_EQ(reports_[1].rendererPhase, RendererPhase::Diff);
+
+  stubClock_->advanceTimeBy(10s);
+  for (int i = 0; i < 100; i++) {
+    stallDetector_->sample();
+  }
+  EXPECT_EQ(
+      reports_.size(), RuntimeSchedulerStallDetector::kMaxReportsPerTask);
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, restoresTheOuterTask) {
+  auto outerStartTime = stubClock_->getNow();
+  auto outerTask = RuntimeSchedulerStallDetector::ScopedTask{
+      *stallDetector_, createTaskInfo(), outerStartTime};
+  setCurrentRendererPhase(RendererPhase::Commit);
+
+  {
+    auto innerTask = RuntimeSchedulerStallDetector::ScopedTask{
+        *stallDetector_,
+        createTaskInfo(SchedulerPriority::ImmediatePriority),
+        stubClock_->getNow()};
+    setCurrentRendererPhase(RendererPhase::Layout);
+    stubClock_->advanceTimeBy(10ms);
+  }
+
+  stubClock_->advanceTimeBy(50ms);
+  stallDetector_->sample();
+
+  ASSERT_EQ(reports_.size(), 1);
+  EXPECT_EQ(reports_[0].taskStartTime, outerStartTime);
+  EXPECT_EQ(reports_[0].priority, SchedulerPriority::NormalPriority);
+  EXPECT_EQ(reports_[0].rendererPhase, RendererPhase::Commit);
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, keepsTheReportCountOfTheOuterTask) {
+  auto outerTask = RuntimeSchedulerStallDetector::ScopedTask{
+      *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+
+  stubClock_->advanceTimeBy(60ms);
+  stallDetector_->sample();
+  ASSERT_EQ(reports_.size(), 1);
+
+  {
+    auto innerTask = RuntimeSchedulerStallDetector::ScopedTask{
+        *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+    stubClock_->advanceTimeBy(10ms);
+    stallDetector_->sample();
+  }
+
+  // The outer task was already reported for the first threshold.
+  stallDetector_->sample();
+  EXPECT_EQ(reports_.size(), 1);
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, samplesFromAnotherThread) {
+  auto reports = std::vector<RuntimeSchedulerStallReport>{};
+
+  {
+    auto task = RuntimeSchedulerStallDetector::ScopedTask{
+        *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+    stubClock_->advanceTimeBy(60ms);
+    stallDetector_->startWatchdog();
+
+    // The watchdog samples every quarter of the threshold (in real time).
+    auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (reports.empty() && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(1ms);
+      reports = stallDetector_->popReports();
+    }
+  }
+
+  // Joins the watchdog.
+  stallDetector_.reset();
+
+  ASSERT_EQ(reports.size(), 1);
+  EXPECT_EQ(reports[0].sampleTime - reports[0].taskStartTime, 60ms);
+  EXPECT_EQ(reports_.size(), 1);
+}
+
+TEST_F(RuntimeSchedulerStallDetectorTest, ignoresPhasesOutsideOfTasks) {
+  setCurrentRendererPhase(RendererPhase::Mount);
+
+  auto task = RuntimeSchedulerStallDetector::ScopedTask{
+      *stallDetector_, createTaskInfo(), stubClock_->getNow()};
+
+  stubClock_->advanceTimeBy(60ms);
+  stallDetector_->sample();
+
+  ASSERT_EQ(reports_.size(), 1);
+  EXPECT_EQ(reports_[0].step, EventLoopStep::Task);
+  EXPECT_EQ(reports_[0].rendererPhase, RendererPhase::None);
+  EXPECT_EQ(
+      reports_[0].getName(), "Stall in task, normal priority, JS callback");
+}
+
+} // namespace facebook::react
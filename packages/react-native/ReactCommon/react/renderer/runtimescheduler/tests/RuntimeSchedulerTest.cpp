@@ -11,6 +11,7 @@
 #include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
 #include <react/performance/timeline/PerformanceEntryReporter.h>
+#include <react/renderer/runtimescheduler/EventCausality.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <memory>
 #include <semaphore>
@@ -1313,6 +1314,54 @@ TEST_P(RuntimeSchedulerTest, reportsLongTasksWithYielding) {
   EXPECT_EQ(pendingEntries.entries[0].duration, 120);
 }
 
+TEST_P(RuntimeSchedulerTest, propagatesEventCausalityToScheduledTasks) {
+  auto causalityInEventTask = kNoEventCausality;
+  auto causalityInFollowUpTask = kNoEventCausality;
+  auto causalityInAttributedTask = kNoEventCausality;
+  auto causalityInUnrelatedTask = EventCausalityId{1};
+
+  {
+    ScopedEventCausality causality(42);
+    runtimeScheduler_->scheduleTask(
+        SchedulerPriority::UserBlockingPriority,
+        createHostFunctionFromLambda([&](bool /* unused */) {
+          causalityInEventTask = getCurrentEventCausalityId();
+          runtimeScheduler_->scheduleTask(
+              SchedulerPriority::NormalPriority,
+              createHostFunctionFromLambda([&](bool /* unused */) {
+                causalityInFollowUpTask = getCurrentEventCausalityId();
+                return jsi::Value::undefined();
+              }));
+          return jsi::Value::undefined();
+        }));
+  }
+
+  EXPECT_EQ(getCurrentEventCausalityId(), kNoEventCausality);
+
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::NormalPriority,
+      createHostFunctionFromLambda([&](bool /* unused */) {
+        causalityInUnrelatedTask = getCurrentEventCausalityId();
+        // Like an event dispatched in the middle of the task.
+        attributeCurrentScopeToEvent(7);
+        runtimeScheduler_->scheduleTask(
+            SchedulerPriority::NormalPriority,
+            createHostFunctionFromLambda([&](bool /* unused */) {
+              causalityInAttributedTask = getCurrentEventCausalityId();
+              return jsi::Value::undefined();
+            }));
+        return jsi::Value::undefined();
+      }));
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(causalityInEventTask, 42);
+  EXPECT_EQ(causalityInFollowUpTask, 42);
+  EXPECT_EQ(causalityInUnrelatedTask, kNoEventCausality);
+  EXPECT_EQ(causalityInAttributedTask, 7);
+  EXPECT_EQ(getCurrentEventCausalityId(), kNoEventCausality);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     UseModernRuntimeScheduler,
     RuntimeSchedulerTest,
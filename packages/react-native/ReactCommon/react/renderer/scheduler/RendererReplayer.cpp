@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RendererReplayer.h"
+
+#include <glog/logging.h>
+
+#include <cxxreact/SystraceSection.h>
+#include <react/config/ReactNativeConfig.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+#include <utility>
+
+namespace facebook::react {
+
+using Operation = RendererRecording::Operation;
+
+size_t MountingMutationCounts::getTotalCount() const {
+  return createCount + deleteCount + insertCount + removeCount + updateCount;
+}
+
+void MountingMutationCounts::add(const ShadowViewMutation& mutation) {
+  switch (mutation.type) {
+    case ShadowViewMutation::Create:
+      createCount++;
+      break;
+    case ShadowViewMutation::Delete:
+      deleteCount++;
+      break;
+    case ShadowViewMutation::Insert:
+      insertCount++;
+      break;
+    case ShadowViewMutation::Remove:
+      removeCount++;
+      break;
+    case ShadowViewMutation::Update:
+      updateCount++;
+      break;
+  }
+}
+
+const TelemetryHistogram& RendererReplayStats::getHistogram(
+    SurfaceTelemetry::Metric metric) const {
+  return histograms[static_cast<size_t>(metric)];
+}
+
+RendererReplayer::RendererReplayer(
+    ComponentRegistryFactory componentRegistryFactory) {
+  // There is no JavaScript: work scheduled on the runtime is dropped.
+  RuntimeExecutor runtimeExecutor =
+      [](std::function<void(jsi::Runtime & runtime)>&& /*callback*/) {};
+
+  runtimeScheduler_ = std::make_shared<RuntimeScheduler>(runtimeExecutor);
+
+  auto contextContainer = std::make_shared<ContextContainer>();
+  contextContainer->insert(
+      "ReactNativeConfig",
+      std::shared_ptr<const ReactNativeConfig>(
+          std::make_shared<EmptyReactNativeConfig>()));
+  contextContainer->insert(
+      "RuntimeScheduler", std::weak_ptr<RuntimeScheduler>(runtimeScheduler_));
+
+  auto toolbox = SchedulerToolbox{};
+  toolbox.contextContainer = contextContainer;
+  toolbox.componentRegistryFactory = std::move(componentRegistryFactory);
+  toolbox.runtimeExecutor = runtimeExecutor;
+  toolbox.asynchronousEventBeatFactory =
+      [](const EventBeat::SharedOwnerBox& ownerBox) {
+        return std::make_unique<EventBeat>(ownerBox);
+      };
+
+  scheduler_ = std::make_unique<Scheduler>(toolbox, nullptr, this);
+  surfaceManager_ = std::make_unique<SurfaceManager>(*scheduler_);
+}
+
+RendererReplayer::~RendererReplayer() noexcept {
+  stopSurfaces();
+}
+
+RendererReplayStats RendererReplayer::replay(
+    const RendererRecording& recording) {
+  SystraceSection s("RendererReplayer::replay");
+
+  stats_ = {};
+  nodes_.clear();
+
+  const auto& operations = recording.operations;
+
+  // Nodes are only retained as long as the recording refers to them, like
+  // React retains them, so the replayed trees share as much as the recorded
+  // ones.
+  auto recordUse = [&](const RendererRecording::Node& node, size_t index) {
+    if (node.id != 0) {
+      nodes_[node.id].lastUse = index;
+    }
+  };
+  for (size_t i = 0; i < operations.size(); i++) {
+    const auto& operation = operations[i];
+    recordUse(operation.node, i);
+    recordUse(operation.sourceNode, i);
+    for (const auto& child : operation.children) {
+      recordUse(child, i);
+    }
+  }
+
+  for (size_t i = 0; i < operations.size(); i++) {
+    replayOperation(operations[i]);
+    releaseNodes(operations[i], i);
+  }
+
+  auto mountedSurfaceIds = std::vector<SurfaceId>{};
+  for (auto& [surfaceId, surface] : surfaces_) {
+    if (mountSurface(surface)) {
+      mountedSurfaceIds.push_back(surfaceId);
+    }
+  }
+  if (!mountedSurfaceIds.empty()) {
+    scheduler_->reportMounts(mountedSurfaceIds);
+  }
+
+  for (const auto& [surfaceId, surface] : surfaces_) {
+    collectSurfaceTelemetry(surface);
+  }
+
+  nodes_.clear();
+  stats_.numberOfOperations = static_cast<int>(operations.size());
+  return std::exchange(stats_, {});
+}
+
+void RendererReplayer::stopSurfaces() {
+  while (!surfaces_.empty()) {
+    stopSurface(surfaces_.begin()->first);
+  }
+}
+
+const StubViewTree* RendererReplayer::findStubViewTree(
+    SurfaceId surfaceId) const {
+  auto it = surfaces_.find(surfaceId);
+  return it != surfaces_.end() ? &it->second.stubViewTree : nullptr;
+}
+
+std::shared_ptr<UIManager> RendererReplayer::getUIManager() const {
+  return scheduler_->getUIManager();
+}
+
+#pragma mark - Private
+
+void RendererReplayer::replayOperation(const Operation& operation) {
+  auto uiManager = scheduler_->getUIManager();
+  auto surfaceId = operation.surfaceId;
+
+  switch (operation.type) {
+    case Operation::StartSurface:
+      startSurface(operation);
+      break;
+
+    case Operation::StopSurface:
+      stopSurface(surfaceId);
+      break;
+
+    case Operation::CreateNode: {
+      auto shadowNode = uiManager->createNode(
+          operation.node.tag,
+          operation.name,
+          surfaceId,
+          RawProps(operation.props),
+          nullptr);
+      nodes_[operation.node.id].shadowNode = std::move(shadowNode);
+      break;
+    }
+
+    case Operation::CloneNode: {
+      auto sourceShadowNode = resolveNode(operation.sourceNode, surfaceId);
+      auto children = operation.hasChildren
+          ? resolveNodes(operation.children, surfaceId)
+          : nullptr;
+      if (sourceShadowNode == nullptr ||
+          (operation.hasChildren && children == nullptr)) {
+        stats_.numberOfSkippedOperations++;
+        break;
+      }
+
+      auto shadowNode = uiManager->cloneNode(
+          *sourceShadowNode,
+          children,
+          operation.props.isNull() ? RawProps() : RawProps(operation.props));
+      nodes_[operation.node.id].shadowNode = std::move(shadowNode);
+      break;
+    }
+
+    case Operation::AppendChild: {
+      auto parentShadowNode = resolveNode(operation.node, surfaceId);
+      auto childShadowNode = resolveNode(operation.sourceNode, surfaceId);
+      if (parentShadowNode == nullptr || childShadowNode == nullptr) {
+        stats_.numberOfSkippedOperations++;
+        break;
+      }
+
+      uiManager->appendChild(parentShadowNode, childShadowNode);
+      break;
+    }
+
+    case Operation::CompleteSurface: {
+      auto children = resolveNodes(operation.children, surfaceId);
+      if (children == nullptr) {
+        stats_.numberOfSkippedOperations++;
+        break;
+      }
+
+      // Same options as commits coming from React.
+      uiManager->completeSurface(
+          surfaceId,
+          children,
+          {.enableStateReconciliation = true, .mountSynchronously = false});
+      break;
+    }
+
+    case Operation::UpdateState: {
+      auto shadowNode = resolveNode(operation.node, surfaceId);
+      if (shadowNode == nullptr || shadowNode->getState() == nullptr) {
+        stats_.numberOfSkippedOperations++;
+        break;
+      }
+
+      // The node retains its family.
+      auto family =
+          SharedShadowNodeFamily(shadowNode, &shadowNode->getFamily());
+#ifdef ANDROID
+      if (!operation.stateData.isNull()) {
+        // Applied directly rather than through `State::updateState`, which
+        // may queue the update instead of committing it.
+        uiManager->updateState(StateUpdate{
+            std::move(family),
+            [state = shadowNode->getState(), data = operation.stateData](
+                const StateData::Shared& previousData) {
+              return state->createData(previousData, data);
+            }});
+        break;
+      }
+#endif
+      stats_.numberOfStateUpdatesWithoutData++;
+      uiManager->updateState(StateUpdate{
+          std::move(family),
+          [](const StateData::Shared& data) { return data; }});
+      break;
+    }
+
+    case Operation::Mount: {
+      for (auto mountedSurfaceId : operation.surfaceIds) {
+        auto it = surfaces_.find(mountedSurfaceId);
+        if (it != surfaces_.end()) {
+          mountSurface(it->second);
+        }
+      }
+      scheduler_->reportMounts(operation.surfaceIds);
+      break;
+    }
+  }
+}
+
+void RendererReplayer::releaseNodes(const Operation& operation, size_t index) {
+  auto release = [&](const RendererRecording::Node& node) {
+    if (node.id == 0) {
+      return;
+    }
+    auto it = nodes_.find(node.id);
+    if (it != nodes_.end() && it->second.lastUse == index) {
+      nodes_.erase(it);
+    }
+  };
+
+  release(operation.node);
+  release(operation.sourceNode);
+  for (const auto& child : operation.children) {
+    release(child);
+  }
+}
+
+void RendererReplayer::startSurface(const Operation& operation) {
+  auto layoutConstraints = operation.layoutConstraints;
+  if (layoutConstraints.layoutDirection == LayoutDirection::Undefined) {
+    layoutConstraints.layoutDirection = LayoutDirection::LeftToRight;
+  }
+
+  surfaceManager_->startSurface(
+      operation.surfaceId,
+      operation.name,
+      folly::dynamic::object(),
+      layoutConstraints,
+      operation.layoutContext);
+
+  auto mountingCoordinator =
+      surfaceManager_->findMountingCoordinator(operation.surfaceId);
+  if (mountingCoordinator == nullptr) {
+    LOG(ERROR) << "RendererReplayer: could not start surface "
+               << operation.surfaceId << ".";
+    return;
+  }
+
+  auto stubViewTree = buildStubViewTreeWithoutUsingDifferentiator(
+      *mountingCoordinator->getBaseRevision().rootShadowNode);
+  surfaces_.insert_or_assign(
+      operation.surfaceId,
+      Surface{std::move(mountingCoordinator), std::move(stubViewTree)});
+}
+
+void RendererReplayer::stopSurface(SurfaceId surfaceId) {
+  auto it = surfaces_.find(surfaceId);
+  if (it == surfaces_.end()) {
+    return;
+  }
+
+  auto& surface = it->second;
+
+  // The empty tree committed by stopping the surface can't be pulled once
+  // the `ShadowTree` is gone, so it's committed (and mounted) beforehand.
+  scheduler_->getUIManager()->getShadowTreeRegistry().visit(
+      surfaceId,
+      [](const ShadowTree& shadowTree) { shadowTree.commitEmptyTree(); });
+  mountSurface(surface);
+
+  surfaceManager_->stopSurface(surfaceId);
+  scheduler_->reportMounts({surfaceId});
+
+  collectSurfaceTelemetry(surface);
+  surfaces_.erase(it);
+}
+
+bool RendererReplayer::mountSurface(Surface& surface) {
+  return surface.mountingCoordinator->getTelemetryController().pullTransaction(
+      [](const MountingTransaction& /*transaction*/,
+         const SurfaceTelemetry& /*surfaceTelemetry*/) {},
+      [&](const MountingTransaction& transaction,
+          const SurfaceTelemetry& /*surfaceTelemetry*/) {
+        surface.stubViewTree.mutate(transaction.getMutations());
+      },
+      [&](const MountingTransaction& transaction,
+          const SurfaceTelemetry& /*surfaceTelemetry*/) {
+        const auto& telemetry = transaction.getTelemetry();
+        stats_.numberOfTransactions++;
+        stats_.numberOfShadowNodeAllocations +=
+            telemetry.getNumberOfShadowNodeAllocations();
+        stats_.numberOfChildrenListAllocations +=
+            telemetry.getNumberOfChildrenListAllocations();
+        for (const auto& mutation : transaction.getMutations()) {
+          stats_.mutationCounts.add(mutation);
+        }
+      });
+}
+
+void RendererReplayer::collectSurfaceTelemetry(const Surface& surface) {
+  auto surfaceTelemetry =
+      surface.mountingCoordinator->getTelemetryController()
+          .sampleSurfaceTelemetry(/* resetHistograms */ true);
+  for (size_t i = 0; i < SurfaceTelemetry::kNumberOfMetrics; i++) {
+    stats_.histograms[i].merge(surfaceTelemetry.getHistogram(
+        static_cast<SurfaceTelemetry::Metric>(i)));
+  }
+}
+
+ShadowNode::Shared RendererReplayer::resolveNode(
+    const RendererRecording::Node& node,
+    SurfaceId surfaceId) const {
+  if (node.id != 0) {
+    auto it = nodes_.find(node.id);
+    if (it != nodes_.end() && it->second.shadowNode != nullptr) {
+      return it->second.shadowNode;
+    }
+  }
+
+  auto shadowNode = ShadowNode::Shared{};
+  scheduler_->getUIManager()->getShadowTreeRegistry().visit(
+      surfaceId, [&](const ShadowTree& shadowTree) {
+        shadowNode = shadowTree.findShadowNodeByTag(node.tag);
+      });
+  return shadowNode;
+}
+
+ShadowNode::UnsharedListOfShared RendererReplayer::resolveNodes(
+    const std::vector<RendererRecording::Node>& nodes,
+    SurfaceId surfaceId) const {
+  auto shadowNodes = std::make_shared<ShadowNode::ListOfShared>();
+  shadowNodes->reserve(nodes.size());
+  for (const auto& node : nodes) {
+    auto shadowNode = resolveNode(node, surfaceId);
+    if (shadowNode == nullptr) {
+      return nullptr;
+    }
+    shadowNodes->push_back(std::move(shadowNode));
+  }
+  return shadowNodes;
+}
+
+#pragma mark - SchedulerDelegate
+
+// Transactions are only mounted when the recording says so.
+
+void RendererReplayer::schedulerDidFinishTransaction(
+    const MountingCoordinator::Shared& /*mountingCoordinator*/) {}
+
+void RendererReplayer::schedulerShouldRenderTransactions(
+    const MountingCoordinator::Shared& /*mountingCoordinator*/) {}
+
+void RendererReplayer::schedulerDidRequestPreliminaryViewAllocation(
+    const ShadowNode& /*shadowNode*/) {}
+
+void RendererReplayer::schedulerDidDispatchCommand(
+    const ShadowView& /*shadowView*/,
+    const std::string& /*commandName*/,
+    const folly::dynamic& /*args*/) {}
+
+void RendererReplayer::schedulerDidSendAccessibilityEvent(
+    const ShadowView& /*shadowView*/,
+    const std::string& /*eventType*/) {}
+
+void RendererReplayer::schedulerDidSetIsJSResponder(
+    const ShadowView& /*shadowView*/,
+    bool /*isJSResponder*/,
+    bool /*blockNativeResponder*/) {}
+
+} // namespace facebook::react
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+#include <react/renderer/componentregistry/ComponentDescriptorFactory.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <react/renderer/mounting/stubs/StubViewTree.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/scheduler/Scheduler.h>
+#include <react/renderer/scheduler/SchedulerDelegate.h>
+#include <react/renderer/scheduler/SurfaceManager.h>
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
+#include <react/renderer/uimanager/RendererRecording.h>
+
+namespace facebook::react {
+
+/*
+ * Number of mutations of each type in a set of mounting transactions.
+ */
+struct MountingMutationCounts {
+  size_t createCount{0};
+  size_t deleteCount{0};
+  size_t insertCount{0};
+  size_t removeCount{0};
+  size_t updateCount{0};
+
+  size_t getTotalCount() const;
+
+  void add(const ShadowViewMutation& mutation);
+};
+
+/*
+ * What was measured while replaying a recording.
+ */
+struct RendererReplayStats final {
+  int numberOfOperations{0};
+
+  // Operations referring to nodes that couldn't be found (e.g. updating the
+  // state of a node that was already removed); these are skipped.
+  int numberOfSkippedOperations{0};
+
+  // State updates replayed with the data the node already has, because the
+  // recording doesn't have the new data (it's only recorded on Android).
+  int numberOfStateUpdatesWithoutData{0};
+
+  // Transactions pulled from the mounting coordinators and applied to the
+  // stub view trees.
+  int numberOfTransactions{0};
+
+  MountingMutationCounts mutationCounts{};
+
+  // Allocated by the commits (see `TransactionTelemetry`).
+  int numberOfShadowNodeAllocations{0};
+  int numberOfChildrenListAllocations{0};
+
+  // Distributions of the metrics of the transactions of all surfaces.
+  std::array<TelemetryHistogram, SurfaceTelemetry::kNumberOfMetrics>
+      histograms{};
+
+  const TelemetryHistogram& getHistogram(SurfaceTelemetry::Metric metric) const;
+};
+
+/*
+ * Replays operations captured by `RendererRecorder` without JavaScript:
+ * they go through `Scheduler` (and `UIManager`) to `ShadowTree`, and
+ * transactions are pulled from `MountingCoordinator` and mounted on
+ * `StubViewTree`s when the recording says the host platform mounted them.
+ * State updates are replayed with the recorded data where it was recorded
+ * (Android); elsewhere, with the data the node already has, so they cost as
+ * much to commit but may cause fewer mutations.
+ * Not thread-safe; everything happens on the calling thread.
+ */
+class RendererReplayer final : public SchedulerDelegate {
+ public:
+  explicit RendererReplayer(ComponentRegistryFactory componentRegistryFactory);
+  ~RendererReplayer() noexcept override;
+
+  /*
+   * Replays all the operations of `recording`, then mounts the pending
+   * transactions. Surfaces that aren't stopped by the recording keep running
+   * (and can be used by the following replays) until `stopSurfaces` is
+   * called.
+   */
+  RendererReplayStats replay(const RendererRecording& recording);
+
+  /*
+   * Stops all the running surfaces, mounting their removal.
+   */
+  void stopSurfaces();
+
+  /*
+   * Returns the views mounted in a running surface, or `nullptr`.
+   */
+  const StubViewTree* findStubViewTree(SurfaceId surfaceId) const;
+
+  std::shared_ptr<UIManager> getUIManager() const;
+
+#pragma mark - SchedulerDelegate
+
+  void schedulerDidFinishTransaction(
+      const MountingCoordinator::Shared& mountingCoordinator) override;
+  void schedulerShouldRenderTransactions(
+      const MountingCoordinator::Shared& mountingCoordinator) override;
+  void schedulerDidRequestPreliminaryViewAllocation(
+      const ShadowNode& shadowNode) override;
+  void schedulerDidDispatchCommand(
+      const ShadowView& shadowView,
+      const std::string& commandName,
+      const folly::dynamic& args) override;
+  void schedulerDidSendAccessibilityEvent(
+      const ShadowView& shadowView,
+      const std::string& eventType) override;
+  void schedulerDidSetIsJSResponder(
+      const ShadowView& shadowView,
+      bool isJSResponder,
+      bool blockNativeResponder) override;
+
+ private:
+  struct Surface {
+    MountingCoordinator::Shared mountingCoordinator;
+    StubViewTree stubViewTree;
+  };
+
+  struct ReplayedNode {
+    ShadowNode::Shared shadowNode;
+    // Index of the last operation referring to the node.
+    size_t lastUse{0};
+  };
+
+  void replayOperation(const RendererRecording::Operation& operation);
+
+  /*
+   * Releases the nodes that are not referred to after the operation at
+   * `index`.
+   */
+  void releaseNodes(
+      const RendererRecording::Operation& operation,
+      size_t index);
+
+  void startSurface(const RendererRecording::Operation& operation);
+  void stopSurface(SurfaceId surfaceId);
+
+  /*
+   * Pulls the pending transaction of a surface, if any, and mounts it.
+   * Returns `true` if there was one.
+   */
+  bool mountSurface(Surface& surface);
+
+  /*
+   * Adds the telemetry gathered for a surface since the previous call.
+   */
+  void collectSurfaceTelemetry(const Surface& surface);
+
+  /*
+   * Returns the node created by a recorded operation or, for nodes that were
+   * not, the current node with the same tag in the surface.
+   */
+  ShadowNode::Shared resolveNode(
+      const RendererRecording::Node& node,
+      SurfaceId surfaceId) const;
+  ShadowNode::UnsharedListOfShared resolveNodes(
+      const std::vector<RendererRecording::Node>& nodes,
+      SurfaceId surfaceId) const;
+
+  // Declared first so it outlives the `Scheduler` referring to it.
+  std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::unique_ptr<Scheduler> scheduler_;
+  std::unique_ptr<SurfaceManager> surfaceManager_;
+
+  std::unordered_map<SurfaceId, Surface> surfaces_{};
+
+  // Nodes referred to by the operations of the current replay.
+  std::unordered_map<RendererRecording::NodeId, ReplayedNode> nodes_{};
+
+  RendererReplayStats stats_{};
+};
+
+} // namespace facebook::react
@@ -98,11 +98,20 @@ Scheduler::Scheduler(
     uiManager->updateState(stateUpdate);
   };
 
+  auto stateBatchPipe = [uiManager](
+                            const std::vector<StateUpdate>& stateUpdates) {
+    uiManager->updateStates(stateUpdates);
+  };
+
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
   eventDispatcher_->emplace(
       EventQueueProcessor(
-          eventPipe, eventPipeConclusion, statePipe, eventPerformanceLogger_),
+          eventPipe,
+          eventPipeConclusion,
+          statePipe,
+          eventPerformanceLogger_,
+          stateBatchPipe),
       schedulerToolbox.asynchronousEventBeatFactory,
       eventOwnerBox,
       *runtimeScheduler,
@@ -364,6 +373,10 @@ void Scheduler::reportMount(SurfaceId surfaceId) const {
   uiManager_->reportMount(surfaceId);
 }
 
+void Scheduler::reportMounts(const std::vector<SurfaceId>& surfaceIds) const {
+  uiManager_->reportMounts(surfaceIds);
+}
+
 ContextContainer::Shared Scheduler::getContextContainer() const {
   return contextContainer_;
 }
@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <ReactCommon/RuntimeExecutor.h>
 #include <react/config/ReactNativeConfig.h>
@@ -107,6 +108,7 @@ class Scheduler final : public UIManagerDelegate {
   std::shared_ptr<UIManager> getUIManager() const;
 
   void reportMount(SurfaceId surfaceId) const;
+  void reportMounts(const std::vector<SurfaceId>& surfaceIds) const;
 
 #pragma mark - Event listeners
   void addEventListener(std::shared_ptr<const EventListener> listener);
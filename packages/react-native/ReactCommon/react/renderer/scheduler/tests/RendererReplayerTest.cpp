@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/mounting/stubs/stubs.h>
+#include <react/renderer/scheduler/RendererReplayer.h>
+#include <react/renderer/uimanager/RendererRecorder.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+namespace facebook::react {
+
+using Operation = RendererRecording::Operation;
+
+class RendererReplayerTest : public ::testing::Test {
+ public:
+  RendererReplayerTest() {
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  }
+
+ protected:
+  std::unique_ptr<RendererReplayer> makeReplayer() {
+    return std::make_unique<RendererReplayer>(
+        [this](
+            const EventDispatcher::Weak& eventDispatcher,
+            const ContextContainer::Shared& contextContainer) {
+          return providerRegistry_.createComponentDescriptorRegistry(
+              {eventDispatcher, contextContainer});
+        });
+  }
+
+  /*
+   * Renders two views in a surface, then changes the props of the inner one.
+   */
+  static RendererRecording makeRecording() {
+    auto recording = RendererRecording{};
+    auto& operations = recording.operations;
+
+    auto startSurface = Operation{};
+    startSurface.type = Operation::StartSurface;
+    startSurface.surfaceId = kSurfaceId;
+    startSurface.name = "TestScreen";
+    startSurface.layoutConstraints.maximumSize = {400, 800};
+    startSurface.layoutContext.pointScaleFactor = 2;
+    operations.push_back(startSurface);
+
+    auto createParent = Operation{};
+    createParent.type = Operation::CreateNode;
+    createParent.surfaceId = kSurfaceId;
+    createParent.node = {1, 2};
+    createParent.name = "View";
+    createParent.props = folly::dynamic::object("nativeID", "parent")(
+        "width", 200)("height", 200);
+    operations.push_back(createParent);
+
+    auto createChild = Operation{};
+    createChild.type = Operation::CreateNode;
+    createChild.surfaceId = kSurfaceId;
+    createChild.node = {2, 4};
+    createChild.name = "View";
+    createChild.props = folly::dynamic::object("nativeID", "child")(
+        "width", 100)("height", 100);
+    operations.push_back(createChild);
+
+    auto appendChild = Operation{};
+    appendChild.type = Operation::AppendChild;
+    appendChild.surfaceId = kSurfaceId;
+    appendChild.node = {1, 2};
+    appendChild.sourceNode = {2, 4};
+    operations.push_back(appendChild);
+
+    auto completeSurface = Operation{};
+    completeSurface.type = Operation::CompleteSurface;
+    completeSurface.surfaceId = kSurfaceId;
+    completeSurface.hasChildren = true;
+    completeSurface.children = {{1, 2}};
+    operations.push_back(completeSurface);
+
+    auto mount = Operation{};
+    mount.type = Operation::Mount;
+    mount.surfaceIds = {kSurfaceId};
+    operations.push_back(mount);
+
+    auto cloneChild = Operation{};
+    cloneChild.type = Operation::CloneNode;
+    cloneChild.surfaceId = kSurfaceId;
+    cloneChild.node = {3, 4};
+    cloneChild.sourceNode = {2, 4};
+    cloneChild.props = folly::dynamic::object("opacity", 0.5);
+    operations.push_back(cloneChild);
+
+    auto cloneParent = Operation{};
+    cloneParent.type = Operation::CloneNode;
+    cloneParent.surfaceId = kSurfaceId;
+    cloneParent.node = {4, 2};
+    cloneParent.sourceNode = {1, 2};
+    cloneParent.hasChildren = true;
+    cloneParent.children = {{3, 4}};
+    operations.push_back(cloneParent);
+
+    completeSurface.children = {{4, 2}};
+    operations.push_back(completeSurface);
+    operations.push_back(mount);
+
+    return recording;
+  }
+
+  static ShadowNode::Shared getCurrentRootShadowNode(
+      const RendererReplayer& replayer) {
+    auto rootShadowNode = ShadowNode::Shared{};
+    replayer.getUIManager()->getShadowTreeRegistry().visit(
+        kSurfaceId, [&](const ShadowTree& shadowTree) {
+          rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        });
+    return rootShadowNode;
+  }
+
+  static constexpr SurfaceId kSurfaceId = 1;
+
+  ComponentDescriptorProviderRegistry providerRegistry_{};
+};
+
+TEST_F(RendererReplayerTest, replayMountsTheRecordedTree) {
+  auto replayer = makeReplayer();
+
+  auto stats = replayer->replay(makeRecording());
+
+  EXPECT_EQ(stats.numberOfOperations, 10);
+  EXPECT_EQ(stats.numberOfSkippedOperations, 0);
+  EXPECT_EQ(stats.numberOfTransactions, 2);
+  EXPECT_EQ(stats.mutationCounts.createCount, 2);
+  EXPECT_EQ(stats.mutationCounts.insertCount, 2);
+  EXPECT_EQ(stats.mutationCounts.deleteCount, 0);
+  EXPECT_GE(stats.mutationCounts.updateCount, 1);
+  EXPECT_EQ(
+      stats.getHistogram(SurfaceTelemetry::Metric::CommitTime).getCount(), 2);
+
+  const auto* stubViewTree = replayer->findStubViewTree(kSurfaceId);
+  ASSERT_NE(stubViewTree, nullptr);
+  auto rootShadowNode = getCurrentRootShadowNode(*replayer);
+  ASSERT_NE(rootShadowNode, nullptr);
+  EXPECT_EQ(stubViewTree->size(), 3);
+  EXPECT_EQ(
+      *stubViewTree,
+      buildStubViewTreeWithoutUsingDifferentiator(*rootShadowNode));
+
+  replayer->stopSurfaces();
+
+  EXPECT_EQ(replayer->findStubViewTree(kSurfaceId), nullptr);
+}
+
+TEST_F(RendererReplayerTest, replayedOperationsCanBeRecordedAgain) {
+  auto replayer = makeReplayer();
+  auto recorder = std::make_shared<RendererRecorder>();
+  replayer->getUIManager()->setRecorder(recorder);
+  replayer->replay(makeRecording());
+  replayer->getUIManager()->setRecorder(nullptr);
+
+  auto data = serializeRendererRecording(recorder->takeRecording());
+  auto recording = deserializeRendererRecording(data);
+  ASSERT_TRUE(recording.has_value());
+
+  auto otherReplayer = makeReplayer();
+  auto stats = otherReplayer->replay(*recording);
+
+  EXPECT_EQ(stats.numberOfSkippedOperations, 0);
+  const auto* stubViewTree = replayer->findStubViewTree(kSurfaceId);
+  const auto* otherStubViewTree = otherReplayer->findStubViewTree(kSurfaceId);
+  ASSERT_NE(stubViewTree, nullptr);
+  ASSERT_NE(otherStubViewTree, nullptr);
+  // Props are different instances, so the views are compared by layout.
+  ASSERT_EQ(otherStubViewTree->size(), stubViewTree->size());
+  for (auto tag : {2, 4}) {
+    EXPECT_EQ(
+        otherStubViewTree->getStubView(tag).layoutMetrics,
+        stubViewTree->getStubView(tag).layoutMetrics);
+  }
+}
+
+TEST_F(RendererReplayerTest, operationsReferringToUnknownNodesAreSkipped) {
+  auto replayer = makeReplayer();
+  auto recording = makeRecording();
+
+  auto updateState = Operation{};
+  updateState.type = Operation::UpdateState;
+  updateState.surfaceId = kSurfaceId;
+  updateState.node = {0, 1000};
+  recording.operations.push_back(updateState);
+
+  auto stats = replayer->replay(recording);
+
+  EXPECT_EQ(stats.numberOfSkippedOperations, 1);
+}
+
+} // namespace facebook::react
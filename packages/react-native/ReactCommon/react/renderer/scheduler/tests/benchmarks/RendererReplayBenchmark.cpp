@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/scheduler/RendererReplayer.h>
+#include <react/test_utils/Entropy.h>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * Replays a recording made by `RendererRecorder` (the path of a file written
+ * with `serializeRendererRecording` is the only argument besides the
+ * benchmark flags) or, without one, synthetic recordings of a list that is
+ * re-rendered with a few items changed and moved each time.
+ * Each iteration replays the whole recording in a new `RendererReplayer`;
+ * the counters report the distributions of the per-transaction timings (in
+ * microseconds) and what the replay allocated and mounted, per iteration.
+ */
+
+namespace facebook::react {
+
+using Operation = RendererRecording::Operation;
+
+constexpr SurfaceId kSurfaceId = 1;
+constexpr int kNumberOfRenders = 50;
+
+static ComponentDescriptorProviderRegistry& getProviderRegistry() {
+  static auto providerRegistry = [] {
+    auto providerRegistry = ComponentDescriptorProviderRegistry{};
+    providerRegistry.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    providerRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    return providerRegistry;
+  }();
+  return providerRegistry;
+}
+
+static std::unique_ptr<RendererReplayer> makeReplayer() {
+  return std::make_unique<RendererReplayer>(
+      [](const EventDispatcher::Weak& eventDispatcher,
+         const ContextContainer::Shared& contextContainer) {
+        return getProviderRegistry().createComponentDescriptorRegistry(
+            {eventDispatcher, contextContainer});
+      });
+}
+
+/*
+ * Builds the operations React would perform to render a list of
+ * `numberOfItems` views, then to re-render it `kNumberOfRenders` times with
+ * about a tenth of the items changed and a few moved. Deterministic.
+ */
+static RendererRecording makeListRecording(int numberOfItems) {
+  auto entropy = Entropy{/* seed */ 42};
+  auto recording = RendererRecording{};
+  auto& operations = recording.operations;
+  auto nextNodeId = RendererRecording::NodeId{1};
+
+  auto addCreateNode = [&](Tag tag, folly::dynamic props) {
+    auto operation = Operation{};
+    operation.type = Operation::CreateNode;
+    operation.surfaceId = kSurfaceId;
+    operation.node = {nextNodeId++, tag};
+    operation.name = "View";
+    operation.props = std::move(props);
+    operations.push_back(std::move(operation));
+    return operations.back().node;
+  };
+
+  auto addCloneNode = [&](RendererRecording::Node sourceNode,
+                          folly::dynamic props,
+                          std::optional<std::vector<RendererRecording::Node>>
+                              children) {
+    auto operation = Operation{};
+    operation.type = Operation::CloneNode;
+    operation.surfaceId = kSurfaceId;
+    operation.node = {nextNodeId++, sourceNode.tag};
+    operation.sourceNode = sourceNode;
+    operation.props = std::move(props);
+    operation.hasChildren = children.has_value();
+    if (children.has_value()) {
+      operation.children = std::move(*children);
+    }
+    operations.push_back(std::move(operation));
+    return operations.back().node;
+  };
+
+  auto addCompleteSurfaceAndMount = [&](RendererRecording::Node rootChild) {
+    auto completeSurface = Operation{};
+    completeSurface.type = Operation::CompleteSurface;
+    completeSurface.surfaceId = kSurfaceId;
+    completeSurface.hasChildren = true;
+    completeSurface.children = {rootChild};
+    operations.push_back(std::move(completeSurface));
+
+    auto mount = Operation{};
+    mount.type = Operation::Mount;
+    mount.surfaceIds = {kSurfaceId};
+    operations.push_back(std::move(mount));
+  };
+
+  auto startSurface = Operation{};
+  startSurface.type = Operation::StartSurface;
+  startSurface.surfaceId = kSurfaceId;
+  startSurface.name = "ListBenchmark";
+  startSurface.layoutConstraints.maximumSize = {390, 844};
+  startSurface.layoutContext.pointScaleFactor = 3;
+  operations.push_back(std::move(startSurface));
+
+  auto list = addCreateNode(
+      2, folly::dynamic::object("nativeID", "list")("flexDirection", "column"));
+  auto items = std::vector<RendererRecording::Node>{};
+  for (int i = 0; i < numberOfItems; i++) {
+    auto item = addCreateNode(
+        4 + i * 2,
+        folly::dynamic::object("nativeID", "item-" + std::to_string(i))(
+            "height", 40)("opacity", 1));
+    items.push_back(item);
+
+    auto appendChild = Operation{};
+    appendChild.type = Operation::AppendChild;
+    appendChild.surfaceId = kSurfaceId;
+    appendChild.node = list;
+    appendChild.sourceNode = item;
+    operations.push_back(std::move(appendChild));
+  }
+  addCompleteSurfaceAndMount(list);
+
+  for (int render = 0; render < kNumberOfRenders; render++) {
+    for (int i = 0; i < numberOfItems / 10; i++) {
+      auto index = entropy.random<int>(0, numberOfItems - 1);
+      auto opacity = entropy.random<int>(1, 10) / 10.0;
+      items[index] = addCloneNode(
+          items[index],
+          folly::dynamic::object("opacity", opacity),
+          std::nullopt);
+    }
+    for (int i = 0; i < 2; i++) {
+      std::swap(
+          items[entropy.random<int>(0, numberOfItems - 1)],
+          items[entropy.random<int>(0, numberOfItems - 1)]);
+    }
+    list = addCloneNode(list, nullptr, items);
+    addCompleteSurfaceAndMount(list);
+  }
+
+  auto stopSurface = Operation{};
+  stopSurface.type = Operation::StopSurface;
+  stopSurface.surfaceId = kSurfaceId;
+  operations.push_back(std::move(stopSurface));
+
+  return recording;
+}
+
+static void replay(
+    benchmark::State& state,
+    const RendererRecording& recording) {
+  auto histograms = decltype(RendererReplayStats::histograms){};
+  auto numberOfTransactions = 0;
+  auto numberOfMutations = size_t{0};
+  auto numberOfShadowNodeAllocations = 0;
+  auto numberOfChildrenListAllocations = 0;
+  auto numberOfSkippedOperations = 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto replayer = makeReplayer();
+    state.ResumeTiming();
+
+    auto stats = replayer->replay(recording);
+
+    state.PauseTiming();
+    replayer.reset();
+    state.ResumeTiming();
+
+    for (size_t i = 0; i < histograms.size(); i++) {
+      histograms[i].merge(stats.histograms[i]);
+    }
+    numberOfTransactions += stats.numberOfTransactions;
+    numberOfMutations += stats.mutationCounts.getTotalCount();
+    numberOfShadowNodeAllocations += stats.numberOfShadowNodeAllocations;
+    numberOfChildrenListAllocations += stats.numberOfChildrenListAllocations;
+    numberOfSkippedOperations += stats.numberOfSkippedOperations;
+  }
+
+  auto perIteration = [](double value) {
+    return benchmark::Counter(value, benchmark::Counter::kAvgIterations);
+  };
+  state.counters["transactions"] = perIteration(numberOfTransactions);
+  state.counters["mutations"] = perIteration(numberOfMutations);
+  state.counters["shadowNodeAllocations"] =
+      perIteration(numberOfShadowNodeAllocations);
+  state.counters["childrenListAllocations"] =
+      perIteration(numberOfChildrenListAllocations);
+  state.counters["skippedOperations"] = perIteration(numberOfSkippedOperations);
+
+  auto reportPercentiles = [&](const char* name,
+                               SurfaceTelemetry::Metric metric) {
+    const auto& histogram = histograms[static_cast<size_t>(metric)];
+    state.counters[std::string(name) + "P50"] =
+        static_cast<double>(histogram.getValueAtPercentile(50));
+    state.counters[std::string(name) + "P99"] =
+        static_cast<double>(histogram.getValueAtPercentile(99));
+  };
+  reportPercentiles("commit", SurfaceTelemetry::Metric::CommitTime);
+  reportPercentiles("layout", SurfaceTelemetry::Metric::LayoutTime);
+  reportPercentiles("diff", SurfaceTelemetry::Metric::DiffTime);
+  reportPercentiles("mount", SurfaceTelemetry::Metric::MountTime);
+}
+
+static void replayListRecording(benchmark::State& state) {
+  auto recording = makeListRecording(static_cast<int>(state.range(0)));
+  replay(state, recording);
+}
+
+static std::optional<RendererRecording> readRecording(const char* path) {
+  auto file = std::ifstream(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  auto data = std::string(
+      std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  return deserializeRendererRecording(data);
+}
+
+} // namespace facebook::react
+
+int main(int argc, char** argv) {
+  using namespace facebook::react;
+
+  benchmark::Initialize(&argc, argv);
+
+  if (argc > 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " [benchmark flags] [path to a renderer recording]\n";
+    return 1;
+  }
+
+  if (argc == 2) {
+    auto recording = readRecording(argv[1]);
+    if (!recording.has_value()) {
+      std::cerr << "Could not read a renderer recording from " << argv[1]
+                << ".\n";
+      return 1;
+    }
+    benchmark::RegisterBenchmark(
+        "replayRecording",
+        [recording = std::move(*recording)](benchmark::State& state) {
+          replay(state, recording);
+        })
+        ->Unit(benchmark::kMillisecond);
+  } else {
+    benchmark::RegisterBenchmark("replayListRecording", replayListRecording)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -14,11 +14,40 @@ namespace facebook::react {
 void SurfaceTelemetry::incorporate(
     const TransactionTelemetry& telemetry,
     int numberOfMutations) {
-  layoutTime_ += telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
+  auto layoutTime =
+      telemetry.getLayoutEndTime() - telemetry.getLayoutStartTime();
+  auto commitTime =
+      telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
+  auto diffTime = telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
+  auto mountTime = telemetry.getMountEndTime() - telemetry.getMountStartTime();
+
+  layoutTime_ += layoutTime;
   textMeasureTime_ += telemetry.getTextMeasureTime();
-  commitTime_ += telemetry.getCommitEndTime() - telemetry.getCommitStartTime();
-  diffTime_ += telemetry.getDiffEndTime() - telemetry.getDiffStartTime();
-  mountTime_ += telemetry.getMountEndTime() - telemetry.getMountStartTime();
+  commitTime_ += commitTime;
+  diffTime_ += diffTime;
+  mountTime_ += mountTime;
+
+  histogram(Metric::CommitTime).record(commitTime);
+  // Skipped phases are left out rather than recorded as zero.
+  if (telemetry.getStateReconciliationTime() != TelemetryDuration{0}) {
+    histogram(Metric::StateReconciliationTime)
+        .record(telemetry.getStateReconciliationTime());
+  }
+  histogram(Metric::CommitHooksTime).record(telemetry.getCommitHooksTime());
+  histogram(Metric::LayoutTime).record(layoutTime);
+  if (telemetry.getNumberOfTextMeasurements() > 0) {
+    histogram(Metric::TextMeasureTime).record(telemetry.getTextMeasureTime());
+  }
+  histogram(Metric::DiffTime).record(diffTime);
+  histogram(Metric::MountTime).record(mountTime);
+  if (telemetry.getEventStartTime() != kTelemetryUndefinedTimePoint) {
+    histogram(Metric::EventToMountTime)
+        .record(telemetry.getMountEndTime() - telemetry.getEventStartTime());
+  }
+  histogram(Metric::NumberOfMutations)
+      .record(static_cast<uint64_t>(numberOfMutations));
+  histogram(Metric::AffectedLayoutNodesCount)
+      .record(static_cast<uint64_t>(telemetry.getAffectedLayoutNodesCount()));
 
   numberOfTransactions_++;
   numberOfMutations_ += numberOfMutations;
@@ -80,4 +109,18 @@ SurfaceTelemetry::getRecentTransactionTelemetries() const {
   return result;
 }
 
+const TelemetryHistogram& SurfaceTelemetry::getHistogram(Metric metric) const {
+  return histograms_[static_cast<size_t>(metric)];
+}
+
+void SurfaceTelemetry::resetHistograms() {
+  for (auto& histogram : histograms_) {
+    histogram.reset();
+  }
+}
+
+TelemetryHistogram& SurfaceTelemetry::histogram(Metric metric) {
+  return histograms_[static_cast<size_t>(metric)];
+}
+
 } // namespace facebook::react
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 
+#include <react/renderer/telemetry/TelemetryHistogram.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/utils/Telemetry.h>
 
@@ -22,6 +24,28 @@ class SurfaceTelemetry final {
  public:
   constexpr static size_t kMaxNumberOfRecordedCommitTelemetries = 16;
 
+  /*
+   * Distributions recorded for every incorporated transaction.
+   * Durations are recorded in microseconds.
+   */
+  enum class Metric {
+    CommitTime,
+    StateReconciliationTime,
+    CommitHooksTime,
+    LayoutTime,
+    TextMeasureTime,
+    DiffTime,
+    MountTime,
+    // From the dispatch of the oldest event processed before the commit to
+    // the end of mounting. Only recorded for transactions preceded by events.
+    EventToMountTime,
+    NumberOfMutations,
+    AffectedLayoutNodesCount,
+  };
+
+  constexpr static size_t kNumberOfMetrics =
+      static_cast<size_t>(Metric::AffectedLayoutNodesCount) + 1;
+
   /*
    * Metrics
    */
@@ -38,6 +62,14 @@ class SurfaceTelemetry final {
 
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
+  const TelemetryHistogram& getHistogram(Metric metric) const;
+
+  /*
+   * Clears all histograms (but not the totals), so the next sample only
+   * covers transactions incorporated after this call.
+   */
+  void resetHistograms();
+
   /*
    * Incorporate data from given transaction telemetry into aggregated data
    * for the Surface.
@@ -47,6 +79,8 @@ class SurfaceTelemetry final {
       int numberOfMutations);
 
  private:
+  TelemetryHistogram& histogram(Metric metric);
+
   TelemetryDuration layoutTime_{};
   TelemetryDuration commitTime_{};
   TelemetryDuration textMeasureTime_{};
@@ -59,6 +93,8 @@ class SurfaceTelemetry final {
   int lastRevisionNumber_{};
 
   std::vector<TransactionTelemetry> recentTransactionTelemetries_{};
+
+  std::array<TelemetryHistogram, kNumberOfMetrics> histograms_{};
 };
 
 } // namespace facebook::react
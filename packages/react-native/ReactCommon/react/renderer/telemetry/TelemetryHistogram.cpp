@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TelemetryHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace facebook::react {
+
+/* static */ int TelemetryHistogram::bucketIndexForValue(uint64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<int>(value);
+  }
+
+  // Values in [2^n, 2^(n+1)) land in the `n - kSubBucketBits + 1`-th group of
+  // `kSubBucketCount` buckets, indexed by the bits right below the top one.
+  auto magnitude = std::bit_width(value) - 1;
+  auto shift = magnitude - kSubBucketBits;
+  auto subBucketIndex = static_cast<int>(value >> shift) - kSubBucketCount;
+  return kSubBucketCount * (shift + 1) + subBucketIndex;
+}
+
+/* static */ uint64_t TelemetryHistogram::highestValueInBucket(
+    int bucketIndex) {
+  if (bucketIndex < kSubBucketCount) {
+    return static_cast<uint64_t>(bucketIndex);
+  }
+
+  auto shift = bucketIndex / kSubBucketCount - 1;
+  auto subBucketIndex = bucketIndex % kSubBucketCount;
+  auto lowestValue = static_cast<uint64_t>(kSubBucketCount + subBucketIndex)
+      << shift;
+  return lowestValue + (uint64_t{1} << shift) - 1;
+}
+
+void TelemetryHistogram::record(uint64_t value) {
+  value = std::min(value, kMaxTrackableValue);
+  buckets_[bucketIndexForValue(value)]++;
+  count_++;
+  sum_ += value;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+}
+
+void TelemetryHistogram::record(TelemetryDuration duration) {
+  auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  record(static_cast<uint64_t>(std::max<int64_t>(microseconds, 0)));
+}
+
+void TelemetryHistogram::merge(const TelemetryHistogram& other) {
+  for (size_t i = 0; i < buckets_.size(); i++) {
+    buckets_[i] += other.buckets_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+}
+
+void TelemetryHistogram::reset() {
+  *this = TelemetryHistogram{};
+}
+
+uint64_t TelemetryHistogram::getCount() const {
+  return count_;
+}
+
+uint64_t TelemetryHistogram::getMin() const {
+  return count_ == 0 ? 0 : min_;
+}
+
+uint64_t TelemetryHistogram::getMax() const {
+  return max_;
+}
+
+double TelemetryHistogram::getMean() const {
+  return count_ == 0 ? 0 : static_cast<double>(sum_) / count_;
+}
+
+uint64_t TelemetryHistogram::getValueAtPercentile(double percentile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  auto targetCount = std::max<uint64_t>(
+      static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_)), 1);
+
+  auto accumulatedCount = uint64_t{0};
+  for (int i = 0; i < kBucketCount; i++) {
+    accumulatedCount += buckets_[i];
+    if (accumulatedCount >= targetCount) {
+      return std::clamp(highestValueInBucket(i), min_, max_);
+    }
+  }
+
+  return max_;
+}
+
+} // namespace facebook::react
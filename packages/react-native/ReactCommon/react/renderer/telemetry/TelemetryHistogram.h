@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <react/utils/Telemetry.h>
+
+namespace facebook::react {
+
+/*
+ * Fixed-size log-linear histogram of non-negative integer values.
+ * Every power-of-two range is split into `kSubBucketCount` linear buckets, so
+ * reported percentiles are within 1 / `kSubBucketCount` (12.5%) of the
+ * recorded values. Values above `kMaxTrackableValue` are clamped.
+ * Recording never allocates; the whole histogram is a flat array that is
+ * cheap to copy.
+ */
+class TelemetryHistogram final {
+ public:
+  constexpr static int kSubBucketBits = 3;
+  constexpr static int kSubBucketCount = 1 << kSubBucketBits;
+  constexpr static int kValueBits = 32;
+  constexpr static uint64_t kMaxTrackableValue =
+      (uint64_t{1} << kValueBits) - 1;
+  constexpr static int kBucketCount =
+      kSubBucketCount * (kValueBits - kSubBucketBits + 1);
+
+  /*
+   * Recording
+   */
+  void record(uint64_t value);
+
+  /*
+   * Records a duration in microseconds.
+   */
+  void record(TelemetryDuration duration);
+
+  /*
+   * Adds all values recorded by `other`.
+   */
+  void merge(const TelemetryHistogram& other);
+
+  void reset();
+
+  /*
+   * Reading
+   */
+  uint64_t getCount() const;
+  uint64_t getMin() const;
+  uint64_t getMax() const;
+  double getMean() const;
+
+  /*
+   * Returns the highest value equivalent (within the precision of the
+   * histogram) to the value below which `percentile` percent of the recorded
+   * values fall. Returns `0` if nothing was recorded.
+   */
+  uint64_t getValueAtPercentile(double percentile) const;
+
+ private:
+  static int bucketIndexForValue(uint64_t value);
+  static uint64_t highestValueInBucket(int bucketIndex);
+
+  std::array<uint32_t, kBucketCount> buckets_{};
+  uint64_t count_{0};
+  uint64_t sum_{0};
+  uint64_t min_{kMaxTrackableValue};
+  uint64_t max_{0};
+};
+
+} // namespace facebook::react
@@ -8,13 +8,32 @@
 #include "TransactionTelemetry.h"
 
 #include <react/debug/react_native_assert.h>
+#include <react/utils/RendererPhase.h>
+#include <reactperflogger/fusebox/FuseboxTracer.h>
 
+#include <algorithm>
+#include <string_view>
 #include <utility>
 
 namespace facebook::react {
 
 thread_local TransactionTelemetry* threadLocalTransactionTelemetry = nullptr;
 
+// Tracks of the rendering pipeline in Fusebox traces. Commits (with layout
+// and text measurement nested inside) run on the JavaScript or a background
+// thread; diffing and mounting run on the thread pulling transactions.
+constexpr std::string_view kCommitTrack = "Fabric: Commit";
+constexpr std::string_view kDiffTrack = "Fabric: Diff";
+constexpr std::string_view kMountTrack = "Fabric: Mount";
+
+static void addTraceEvent(
+    std::string_view name,
+    TelemetryTimePoint start,
+    TelemetryTimePoint end,
+    std::string_view track) {
+  FuseboxTracer::getFuseboxTracer().addEvent(name, start, end, track);
+}
+
 TransactionTelemetry::TransactionTelemetry()
     : TransactionTelemetry(telemetryTimePointNow) {}
 
@@ -38,50 +57,99 @@ void TransactionTelemetry::willCommit() {
   react_native_assert(commitStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(commitEndTime_ == kTelemetryUndefinedTimePoint);
   commitStartTime_ = now_();
+  setCurrentRendererPhase(RendererPhase::Commit);
 }
 
 void TransactionTelemetry::didCommit() {
   react_native_assert(commitStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(commitEndTime_ == kTelemetryUndefinedTimePoint);
   commitEndTime_ = now_();
+  addTraceEvent("Commit", commitStartTime_, commitEndTime_, kCommitTrack);
+  setCurrentRendererPhase(RendererPhase::None);
+}
+
+void TransactionTelemetry::willReconcileState() {
+  react_native_assert(
+      stateReconciliationStartTime_ == kTelemetryUndefinedTimePoint);
+  stateReconciliationStartTime_ = now_();
+}
+
+void TransactionTelemetry::didReconcileState() {
+  react_native_assert(
+      stateReconciliationStartTime_ != kTelemetryUndefinedTimePoint);
+  auto stateReconciliationEndTime = now_();
+  stateReconciliationTime_ =
+      stateReconciliationEndTime - stateReconciliationStartTime_;
+  addTraceEvent(
+      "State Reconciliation",
+      stateReconciliationStartTime_,
+      stateReconciliationEndTime,
+      kCommitTrack);
+}
+
+void TransactionTelemetry::willRunCommitHooks() {
+  react_native_assert(commitHooksStartTime_ == kTelemetryUndefinedTimePoint);
+  commitHooksStartTime_ = now_();
+}
+
+void TransactionTelemetry::didRunCommitHooks() {
+  react_native_assert(commitHooksStartTime_ != kTelemetryUndefinedTimePoint);
+  auto commitHooksEndTime = now_();
+  commitHooksTime_ = commitHooksEndTime - commitHooksStartTime_;
+  addTraceEvent(
+      "Commit Hooks", commitHooksStartTime_, commitHooksEndTime, kCommitTrack);
 }
 
 void TransactionTelemetry::willDiff() {
   react_native_assert(diffStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ == kTelemetryUndefinedTimePoint);
   diffStartTime_ = now_();
+  setCurrentRendererPhase(RendererPhase::Diff);
 }
 
 void TransactionTelemetry::didDiff() {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ == kTelemetryUndefinedTimePoint);
   diffEndTime_ = now_();
+  addTraceEvent("Diff", diffStartTime_, diffEndTime_, kDiffTrack);
+  setCurrentRendererPhase(RendererPhase::None);
 }
 
 void TransactionTelemetry::willLayout() {
   react_native_assert(layoutStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ == kTelemetryUndefinedTimePoint);
   layoutStartTime_ = now_();
+  setCurrentRendererPhase(RendererPhase::Layout);
 }
 
 void TransactionTelemetry::willMeasureText() {
   react_native_assert(
       lastTextMeasureStartTime_ == kTelemetryUndefinedTimePoint);
   lastTextMeasureStartTime_ = now_();
+  setCurrentRendererPhase(RendererPhase::TextMeasure);
 }
 
 void TransactionTelemetry::didMeasureText() {
   numberOfTextMeasurements_++;
   react_native_assert(
       lastTextMeasureStartTime_ != kTelemetryUndefinedTimePoint);
-  textMeasureTime_ += now_() - lastTextMeasureStartTime_;
+  auto textMeasureEndTime = now_();
+  textMeasureTime_ += textMeasureEndTime - lastTextMeasureStartTime_;
+  addTraceEvent(
+      "Text Measure",
+      lastTextMeasureStartTime_,
+      textMeasureEndTime,
+      kCommitTrack);
   lastTextMeasureStartTime_ = kTelemetryUndefinedTimePoint;
+  setCurrentRendererPhase(RendererPhase::Layout);
 }
 
 void TransactionTelemetry::didLayout() {
   react_native_assert(layoutStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ == kTelemetryUndefinedTimePoint);
   layoutEndTime_ = now_();
+  addTraceEvent("Layout", layoutStartTime_, layoutEndTime_, kCommitTrack);
+  setCurrentRendererPhase(RendererPhase::Commit);
 }
 
 void TransactionTelemetry::didLayout(int affectedLayoutNodesCount) {
@@ -93,18 +161,51 @@ void TransactionTelemetry::willMount() {
   react_native_assert(mountStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(mountEndTime_ == kTelemetryUndefinedTimePoint);
   mountStartTime_ = now_();
+  setCurrentRendererPhase(RendererPhase::Mount);
 }
 
 void TransactionTelemetry::didMount() {
   react_native_assert(mountStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(mountEndTime_ == kTelemetryUndefinedTimePoint);
   mountEndTime_ = now_();
+  addTraceEvent("Mount", mountStartTime_, mountEndTime_, kMountTrack);
+  setCurrentRendererPhase(RendererPhase::None);
 }
 
 void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setEventStartTime(
+    TelemetryTimePoint eventStartTime) {
+  eventStartTime_ = eventStartTime;
+}
+
+void TransactionTelemetry::setEventCausalityId(
+    EventCausalityId eventCausalityId) {
+  eventCausalityId_ = eventCausalityId;
+}
+
+void TransactionTelemetry::addSupersededEventCausalityId(
+    EventCausalityId eventCausalityId) {
+  if (eventCausalityId == kNoEventCausality ||
+      eventCausalityId == eventCausalityId_ ||
+      std::find(
+          supersededEventCausalityIds_.begin(),
+          supersededEventCausalityIds_.end(),
+          eventCausalityId) != supersededEventCausalityIds_.end()) {
+    return;
+  }
+  supersededEventCausalityIds_.push_back(eventCausalityId);
+}
+
+void TransactionTelemetry::setNumberOfAllocations(
+    int numberOfShadowNodeAllocations,
+    int numberOfChildrenListAllocations) {
+  numberOfShadowNodeAllocations_ = numberOfShadowNodeAllocations;
+  numberOfChildrenListAllocations_ = numberOfChildrenListAllocations;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -153,6 +254,32 @@ TelemetryTimePoint TransactionTelemetry::getMountEndTime() const {
   return mountEndTime_;
 }
 
+TelemetryDuration TransactionTelemetry::getStateReconciliationTime() const {
+  return stateReconciliationTime_;
+}
+
+TelemetryDuration TransactionTelemetry::getCommitHooksTime() const {
+  return commitHooksTime_;
+}
+
+TelemetryTimePoint TransactionTelemetry::getEventStartTime() const {
+  return eventStartTime_;
+}
+
+EventCausalityId TransactionTelemetry::getEventCausalityId() const {
+  return eventCausalityId_;
+}
+
+const std::vector<EventCausalityId>&
+TransactionTelemetry::getSupersededEventCausalityIds() const {
+  return supersededEventCausalityIds_;
+}
+
+bool TransactionTelemetry::hasEventCausality() const {
+  return eventCausalityId_ != kNoEventCausality ||
+      !supersededEventCausalityIds_.empty();
+}
+
 TelemetryDuration TransactionTelemetry::getTextMeasureTime() const {
   return textMeasureTime_;
 }
@@ -169,4 +296,12 @@ int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
 
+int TransactionTelemetry::getNumberOfShadowNodeAllocations() const {
+  return numberOfShadowNodeAllocations_;
+}
+
+int TransactionTelemetry::getNumberOfChildrenListAllocations() const {
+  return numberOfChildrenListAllocations_;
+}
+
 } // namespace facebook::react
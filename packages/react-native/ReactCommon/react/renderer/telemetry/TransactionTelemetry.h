@@ -10,7 +10,9 @@
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
+#include <react/utils/EventCausalityId.h>
 #include <react/utils/Telemetry.h>
 
 namespace facebook::react {
@@ -39,6 +41,10 @@ class TransactionTelemetry final {
   void didDiff();
   void willCommit();
   void didCommit();
+  void willReconcileState();
+  void didReconcileState();
+  void willRunCommitHooks();
+  void didRunCommitHooks();
   void willLayout();
   void willMeasureText();
   void didMeasureText();
@@ -49,6 +55,32 @@ class TransactionTelemetry final {
 
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * Sets the time at which the platform dispatched the oldest event that was
+   * processed since the previous commit, if any.
+   */
+  void setEventStartTime(TelemetryTimePoint eventStartTime);
+
+  /*
+   * Sets the input event that caused the transaction, if any.
+   */
+  void setEventCausalityId(EventCausalityId eventCausalityId);
+
+  /*
+   * Records an event that caused a revision which this one replaced before
+   * it was mounted: that event waits for this transaction instead.
+   * Ignores `kNoEventCausality` and events that are already recorded.
+   */
+  void addSupersededEventCausalityId(EventCausalityId eventCausalityId);
+
+  /*
+   * Sets the number of shadow nodes and children lists allocated for the
+   * transaction (see `getNumberOfShadowNodeAllocations`).
+   */
+  void setNumberOfAllocations(
+      int numberOfShadowNodeAllocations,
+      int numberOfChildrenListAllocations);
+
   /*
    * Reading
    */
@@ -61,12 +93,46 @@ class TransactionTelemetry final {
   TelemetryTimePoint getMountStartTime() const;
   TelemetryTimePoint getMountEndTime() const;
 
+  TelemetryDuration getStateReconciliationTime() const;
+  TelemetryDuration getCommitHooksTime() const;
   TelemetryDuration getTextMeasureTime() const;
+
+  /*
+   * Returns `kTelemetryUndefinedTimePoint` if the transaction wasn't
+   * preceded by any event.
+   */
+  TelemetryTimePoint getEventStartTime() const;
+
+  /*
+   * Returns `kNoEventCausality` if the transaction wasn't attributed to any
+   * event.
+   */
+  EventCausalityId getEventCausalityId() const;
+
+  /*
+   * Events that caused the revisions replaced by this one, oldest first.
+   */
+  const std::vector<EventCausalityId>& getSupersededEventCausalityIds() const;
+
+  /*
+   * Whether the transaction is attributed to any event, either directly or
+   * through a superseded revision.
+   */
+  bool hasEventCausality() const;
+
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
 
   int getAffectedLayoutNodesCount() const;
 
+  /*
+   * Number of shadow nodes and children lists allocated on the committing
+   * thread since its previous successful commit: the clones built by React
+   * for this transaction, failed commit attempts, and the commit itself.
+   */
+  int getNumberOfShadowNodeAllocations() const;
+  int getNumberOfChildrenListAllocations() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
@@ -77,6 +143,15 @@ class TransactionTelemetry final {
   TelemetryTimePoint mountStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountEndTime_{kTelemetryUndefinedTimePoint};
 
+  TelemetryTimePoint stateReconciliationStartTime_{
+      kTelemetryUndefinedTimePoint};
+  TelemetryDuration stateReconciliationTime_{0};
+  TelemetryTimePoint commitHooksStartTime_{kTelemetryUndefinedTimePoint};
+  TelemetryDuration commitHooksTime_{0};
+  TelemetryTimePoint eventStartTime_{kTelemetryUndefinedTimePoint};
+  EventCausalityId eventCausalityId_{kNoEventCausality};
+  std::vector<EventCausalityId> supersededEventCausalityIds_{};
+
   TelemetryTimePoint lastTextMeasureStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryDuration textMeasureTime_{0};
 
@@ -85,6 +160,9 @@ class TransactionTelemetry final {
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
+
+  int numberOfShadowNodeAllocations_{0};
+  int numberOfChildrenListAllocations_{0};
 };
 
 } // namespace facebook::react
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
+#include <react/renderer/telemetry/TelemetryHistogram.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <react/test_utils/MockClock.h>
+
+using namespace facebook::react;
+
+TEST(TelemetryHistogramTest, emptyHistogram) {
+  auto histogram = TelemetryHistogram{};
+
+  EXPECT_EQ(histogram.getCount(), 0);
+  EXPECT_EQ(histogram.getMin(), 0);
+  EXPECT_EQ(histogram.getMax(), 0);
+  EXPECT_EQ(histogram.getMean(), 0);
+  EXPECT_EQ(histogram.getValueAtPercentile(50), 0);
+}
+
+TEST(TelemetryHistogramTest, percentilesAreWithinPrecision) {
+  auto histogram = TelemetryHistogram{};
+
+  for (uint64_t value = 1; value <= 10000; value++) {
+    histogram.record(value);
+  }
+
+  EXPECT_EQ(histogram.getCount(), 10000);
+  EXPECT_EQ(histogram.getMin(), 1);
+  EXPECT_EQ(histogram.getMax(), 10000);
+  EXPECT_DOUBLE_EQ(histogram.getMean(), 5000.5);
+
+  for (auto percentile : {1.0, 25.0, 50.0, 90.0, 99.0, 99.9}) {
+    auto expected = percentile * 100;
+    auto actual =
+        static_cast<double>(histogram.getValueAtPercentile(percentile));
+    auto precision = 1.0 / TelemetryHistogram::kSubBucketCount;
+    EXPECT_GE(actual, expected);
+    EXPECT_LE(actual, expected * (1 + precision));
+  }
+
+  EXPECT_EQ(histogram.getValueAtPercentile(0), 1);
+  EXPECT_EQ(histogram.getValueAtPercentile(100), 10000);
+}
+
+TEST(TelemetryHistogramTest, smallValuesAreExact) {
+  auto histogram = TelemetryHistogram{};
+
+  for (uint64_t value = 0; value < TelemetryHistogram::kSubBucketCount;
+       value++) {
+    histogram.record(value);
+  }
+
+  EXPECT_EQ(histogram.getValueAtPercentile(50), 3);
+  EXPECT_EQ(histogram.getValueAtPercentile(100), 7);
+}
+
+TEST(TelemetryHistogramTest, largeValuesAreClamped) {
+  auto histogram = TelemetryHistogram{};
+
+  histogram.record(std::numeric_limits<uint64_t>::max());
+
+  EXPECT_EQ(histogram.getMax(), TelemetryHistogram::kMaxTrackableValue);
+  EXPECT_EQ(
+      histogram.getValueAtPercentile(100),
+      TelemetryHistogram::kMaxTrackableValue);
+}
+
+TEST(TelemetryHistogramTest, durationsAreRecordedInMicroseconds) {
+  auto histogram = TelemetryHistogram{};
+
+  histogram.record(std::chrono::milliseconds(3));
+
+  EXPECT_EQ(histogram.getMax(), 3000);
+}
+
+TEST(TelemetryHistogramTest, mergeAndReset) {
+  auto histogramA = TelemetryHistogram{};
+  auto histogramB = TelemetryHistogram{};
+
+  histogramA.record(10);
+  histogramB.record(1000);
+  histogramA.merge(histogramB);
+
+  EXPECT_EQ(histogramA.getCount(), 2);
+  EXPECT_EQ(histogramA.getMin(), 10);
+  EXPECT_EQ(histogramA.getMax(), 1000);
+
+  histogramA.reset();
+
+  EXPECT_EQ(histogramA.getCount(), 0);
+  EXPECT_EQ(histogramA.getValueAtPercentile(99), 0);
+}
+
+TEST(TelemetryHistogramTest, surfaceTelemetryRecordsPhases) {
+  auto surfaceTelemetry = SurfaceTelemetry{};
+
+  for (int i = 1; i <= 2; i++) {
+    auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+    telemetry.setEventStartTime(MockClock::now());
+    MockClock::advance_by(std::chrono::milliseconds(1));
+
+    telemetry.willCommit();
+    telemetry.willRunCommitHooks();
+    MockClock::advance_by(std::chrono::milliseconds(2));
+    telemetry.didRunCommitHooks();
+    telemetry.willLayout();
+    MockClock::advance_by(std::chrono::milliseconds(3 * i));
+    telemetry.didLayout(10 * i);
+    telemetry.didCommit();
+
+    telemetry.willDiff();
+    MockClock::advance_by(std::chrono::milliseconds(4));
+    telemetry.didDiff();
+
+    telemetry.willMount();
+    MockClock::advance_by(std::chrono::milliseconds(5));
+    telemetry.didMount();
+
+    surfaceTelemetry.incorporate(telemetry, 7);
+  }
+
+  using Metric = SurfaceTelemetry::Metric;
+
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::CommitHooksTime).getMax(), 2000);
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::LayoutTime).getMin(), 3000);
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::LayoutTime).getMax(), 6000);
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::CommitTime).getMax(), 8000);
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::DiffTime).getMax(), 4000);
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::MountTime).getMax(), 5000);
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::EventToMountTime).getMax(), 18000);
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::NumberOfMutations).getMax(), 7);
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::AffectedLayoutNodesCount).getMax(),
+      20);
+
+  // Skipped phases aren't recorded.
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::StateReconciliationTime)
+          .getCount(),
+      0);
+  EXPECT_EQ(
+      surfaceTelemetry.getHistogram(Metric::TextMeasureTime).getCount(), 0);
+
+  surfaceTelemetry.resetHistograms();
+
+  EXPECT_EQ(surfaceTelemetry.getHistogram(Metric::CommitTime).getCount(), 0);
+  EXPECT_EQ(surfaceTelemetry.getNumberOfTransactions(), 2);
+}
@@ -6,6 +6,7 @@
  */
 
 #include <chrono>
+#include <map>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -13,6 +14,7 @@
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/test_utils/MockClock.h>
 #include <react/utils/Telemetry.h>
+#include <reactperflogger/fusebox/FuseboxTracer.h>
 
 using namespace facebook::react;
 
@@ -174,3 +176,34 @@ TEST(TransactionTelemetryTest, abnormalUseCases) {
       },
       "commitEndTime_");
 }
+
+TEST(TransactionTelemetryTest, tracesPipelinePhases) {
+  auto& tracer = FuseboxTracer::getFuseboxTracer();
+  tracer.startTracing();
+
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+  telemetry.willCommit();
+  telemetry.willLayout();
+  MockClock::advance_by(std::chrono::milliseconds(2));
+  telemetry.didLayout();
+  telemetry.didCommit();
+  telemetry.willDiff();
+  telemetry.didDiff();
+  telemetry.willMount();
+  MockClock::advance_by(std::chrono::milliseconds(1));
+  telemetry.didMount();
+
+  auto durations = std::map<std::string, int64_t>{};
+  tracer.stopTracing([&](const folly::dynamic& eventsChunk) {
+    for (const auto& event : eventsChunk) {
+      if (event["ph"] == "X") {
+        durations[event["name"].asString()] = event["dur"].asInt();
+      }
+    }
+  });
+
+  EXPECT_EQ(durations["Commit"], 2000);
+  EXPECT_EQ(durations["Layout"], 2000);
+  EXPECT_EQ(durations["Diff"], 0);
+  EXPECT_EQ(durations["Mount"], 1000);
+}
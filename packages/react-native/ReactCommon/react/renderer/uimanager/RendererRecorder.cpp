@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RendererRecorder.h"
+
+#include <react/renderer/core/ComponentDescriptor.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+#include <react/renderer/core/State.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace facebook::react {
+
+using Operation = RendererRecording::Operation;
+
+void RendererRecorder::didStartSurface(
+    SurfaceId surfaceId,
+    const std::string& moduleName,
+    const LayoutConstraints& layoutConstraints,
+    const LayoutContext& layoutContext) {
+  auto operation = Operation{};
+  operation.type = Operation::StartSurface;
+  operation.surfaceId = surfaceId;
+  operation.name = moduleName;
+  operation.layoutConstraints = layoutConstraints;
+  operation.layoutContext = layoutContext;
+  // Not meaningful outside of a single layout pass.
+  operation.layoutContext.affectedNodes = nullptr;
+
+  std::scoped_lock lock(mutex_);
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didStopSurface(SurfaceId surfaceId) {
+  auto operation = Operation{};
+  operation.type = Operation::StopSurface;
+  operation.surfaceId = surfaceId;
+
+  std::scoped_lock lock(mutex_);
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didCreateNode(
+    const std::shared_ptr<const ShadowNode>& shadowNode,
+    folly::dynamic props) {
+  auto operation = Operation{};
+  operation.type = Operation::CreateNode;
+  operation.surfaceId = shadowNode->getSurfaceId();
+  operation.name = shadowNode->getComponentName();
+  operation.props = std::move(props);
+
+  std::scoped_lock lock(mutex_);
+  operation.node = {registerNode(shadowNode), shadowNode->getTag()};
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didCloneNode(
+    const ShadowNode& sourceShadowNode,
+    const std::shared_ptr<const ShadowNode>& shadowNode,
+    const ShadowNode::SharedListOfShared& children,
+    folly::dynamic props) {
+  auto operation = Operation{};
+  operation.type = Operation::CloneNode;
+  operation.surfaceId = shadowNode->getSurfaceId();
+  operation.props = std::move(props);
+
+  std::scoped_lock lock(mutex_);
+  operation.sourceNode = nodeFor(sourceShadowNode);
+  operation.hasChildren = children != nullptr;
+  if (children != nullptr) {
+    operation.children = nodesFor(*children);
+  }
+  operation.node = {registerNode(shadowNode), shadowNode->getTag()};
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didAppendChild(
+    const ShadowNode& parentShadowNode,
+    const ShadowNode& childShadowNode) {
+  auto operation = Operation{};
+  operation.type = Operation::AppendChild;
+  operation.surfaceId = parentShadowNode.getSurfaceId();
+
+  std::scoped_lock lock(mutex_);
+  operation.node = nodeFor(parentShadowNode);
+  operation.sourceNode = nodeFor(childShadowNode);
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didCompleteSurface(
+    SurfaceId surfaceId,
+    const ShadowNode::ListOfShared& rootChildren) {
+  auto operation = Operation{};
+  operation.type = Operation::CompleteSurface;
+  operation.surfaceId = surfaceId;
+  operation.hasChildren = true;
+
+  std::scoped_lock lock(mutex_);
+  operation.children = nodesFor(rootChildren);
+  recording_.operations.push_back(std::move(operation));
+}
+
+void RendererRecorder::didUpdateStates(
+    const std::vector<StateUpdate>& stateUpdates) {
+  auto operations = std::vector<Operation>{};
+  operations.reserve(stateUpdates.size());
+  for (const auto& stateUpdate : stateUpdates) {
+    const auto& family = *stateUpdate.family;
+    auto& operation = operations.emplace_back();
+    operation.type = Operation::UpdateState;
+    operation.surfaceId = family.getSurfaceId();
+    // The updated node is a native clone: it's found by tag.
+    operation.node = {0, family.getTag()};
+#ifdef ANDROID
+    // The new data is computed from the most recent state, like the commit
+    // will do (state update callbacks can run several times).
+    if (auto state = family.getMostRecentState()) {
+      if (auto data = stateUpdate.callback(state->getDataPointer())) {
+        operation.stateData =
+            family.getComponentDescriptor().createState(family, data)
+                ->getDynamic();
+      }
+    }
+#endif
+  }
+
+  std::scoped_lock lock(mutex_);
+  for (auto& operation : operations) {
+    recording_.operations.push_back(std::move(operation));
+  }
+}
+
+void RendererRecorder::didMount(const std::vector<SurfaceId>& surfaceIds) {
+  auto operation = Operation{};
+  operation.type = Operation::Mount;
+  operation.surfaceIds = surfaceIds;
+
+  std::scoped_lock lock(mutex_);
+  recording_.operations.push_back(std::move(operation));
+}
+
+RendererRecording RendererRecorder::takeRecording() {
+  std::scoped_lock lock(mutex_);
+  return std::exchange(recording_, {});
+}
+
+RendererRecording::NodeId RendererRecorder::registerNode(
+    const std::shared_ptr<const ShadowNode>& shadowNode) {
+  // Nodes are forgotten once they are deallocated (their addresses can be
+  // reused by nodes that weren't recorded). The threshold doubles so pruning
+  // stays amortized constant-time.
+  if (recordedNodes_.size() >= pruneThreshold_) {
+    std::erase_if(recordedNodes_, [](const auto& item) {
+      return item.second.shadowNode.expired();
+    });
+    pruneThreshold_ = std::max(pruneThreshold_, recordedNodes_.size() * 2);
+  }
+
+  auto nodeId = nextNodeId_++;
+  recordedNodes_[shadowNode.get()] = RecordedNode{nodeId, shadowNode};
+  return nodeId;
+}
+
+RendererRecording::Node RendererRecorder::nodeFor(
+    const ShadowNode& shadowNode) const {
+  auto it = recordedNodes_.find(&shadowNode);
+  if (it == recordedNodes_.end() || it->second.shadowNode.expired()) {
+    return {0, shadowNode.getTag()};
+  }
+  return {it->second.id, shadowNode.getTag()};
+}
+
+std::vector<RendererRecording::Node> RendererRecorder::nodesFor(
+    const ShadowNode::ListOfShared& shadowNodes) const {
+  auto nodes = std::vector<RendererRecording::Node>{};
+  nodes.reserve(shadowNodes.size());
+  for (const auto& shadowNode : shadowNodes) {
+    nodes.push_back(nodeFor(*shadowNode));
+  }
+  return nodes;
+}
+
+} // namespace facebook::react
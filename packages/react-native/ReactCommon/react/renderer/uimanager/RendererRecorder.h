@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/StateUpdate.h>
+#include <react/renderer/uimanager/RendererRecording.h>
+
+namespace facebook::react {
+
+/*
+ * Captures the operations performed on `UIManager` while it's set as its
+ * recorder (see `UIManager::setRecorder`), so they can be replayed later
+ * without JavaScript (see `RendererReplayer`).
+ * The new data of state updates is only recorded on Android (where state data
+ * is serializable, see `State::getDynamic`); elsewhere, only the fact that the
+ * state of a node was updated is recorded.
+ * Thread-safe.
+ */
+class RendererRecorder final {
+ public:
+  void didStartSurface(
+      SurfaceId surfaceId,
+      const std::string& moduleName,
+      const LayoutConstraints& layoutConstraints,
+      const LayoutContext& layoutContext);
+  void didStopSurface(SurfaceId surfaceId);
+
+  /*
+   * `props` are the raw props the node was created or cloned with, converted
+   * to `folly::dynamic`. Null if the node was cloned without new props.
+   */
+  void didCreateNode(
+      const std::shared_ptr<const ShadowNode>& shadowNode,
+      folly::dynamic props);
+  void didCloneNode(
+      const ShadowNode& sourceShadowNode,
+      const std::shared_ptr<const ShadowNode>& shadowNode,
+      const ShadowNode::SharedListOfShared& children,
+      folly::dynamic props);
+  void didAppendChild(
+      const ShadowNode& parentShadowNode,
+      const ShadowNode& childShadowNode);
+  void didCompleteSurface(
+      SurfaceId surfaceId,
+      const ShadowNode::ListOfShared& rootChildren);
+
+  void didUpdateStates(const std::vector<StateUpdate>& stateUpdates);
+  void didMount(const std::vector<SurfaceId>& surfaceIds);
+
+  /*
+   * Returns the operations recorded so far and starts a new recording.
+   * Nodes created before remain known to the new recording.
+   */
+  RendererRecording takeRecording();
+
+ private:
+  struct RecordedNode {
+    RendererRecording::NodeId id;
+    std::weak_ptr<const ShadowNode> shadowNode;
+  };
+
+  RendererRecording::NodeId registerNode(
+      const std::shared_ptr<const ShadowNode>& shadowNode);
+  RendererRecording::Node nodeFor(const ShadowNode& shadowNode) const;
+  std::vector<RendererRecording::Node> nodesFor(
+      const ShadowNode::ListOfShared& shadowNodes) const;
+
+  std::mutex mutex_;
+
+  // Protected by `mutex_`.
+  RendererRecording recording_{};
+  std::unordered_map<const ShadowNode*, RecordedNode> recordedNodes_{};
+  RendererRecording::NodeId nextNodeId_{1};
+  size_t pruneThreshold_{1024};
+};
+
+} // namespace facebook::react
@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RendererRecording.h"
+
+#include <glog/logging.h>
+
+#include <cstring>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr std::string_view kMagic = "RNRR";
+constexpr uint64_t kVersion = 2;
+
+// Bounds the recursion of malformed (or absurdly nested) props.
+constexpr int kMaxDynamicDepth = 256;
+
+enum DynamicType : uint8_t {
+  Null = 0,
+  False = 1,
+  True = 2,
+  Int64 = 3,
+  Double = 4,
+  String = 5,
+  Array = 6,
+  Object = 7,
+};
+
+/*
+ * Integers are stored as LEB128 varints (zigzag-encoded when signed), doubles
+ * as their little-endian IEEE 754 bits. Every string is stored once; the
+ * following occurrences refer to its index.
+ */
+class RecordingWriter final {
+ public:
+  void writeByte(uint8_t value) {
+    data_.push_back(static_cast<char>(value));
+  }
+
+  void writeUnsigned(uint64_t value) {
+    while (value >= 0x80) {
+      writeByte(static_cast<uint8_t>(value) | 0x80);
+      value >>= 7;
+    }
+    writeByte(static_cast<uint8_t>(value));
+  }
+
+  void writeSigned(int64_t value) {
+    writeUnsigned(
+        (static_cast<uint64_t>(value) << 1) ^
+        static_cast<uint64_t>(value >> 63));
+  }
+
+  void writeDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; i++) {
+      writeByte(static_cast<uint8_t>(bits >> (i * 8)));
+    }
+  }
+
+  void writeString(const std::string& value) {
+    auto it = stringIndices_.find(value);
+    if (it != stringIndices_.end()) {
+      writeUnsigned(it->second + 1);
+      return;
+    }
+
+    stringIndices_.emplace(value, stringIndices_.size());
+    writeUnsigned(0);
+    writeUnsigned(value.size());
+    data_.append(value);
+  }
+
+  void writeDynamic(const folly::dynamic& value) {
+    switch (value.type()) {
+      case folly::dynamic::Type::BOOL:
+        writeByte(value.getBool() ? DynamicType::True : DynamicType::False);
+        break;
+      case folly::dynamic::Type::INT64:
+        writeByte(DynamicType::Int64);
+        writeSigned(value.getInt());
+        break;
+      case folly::dynamic::Type::DOUBLE:
+        writeByte(DynamicType::Double);
+        writeDouble(value.getDouble());
+        break;
+      case folly::dynamic::Type::STRING:
+        writeByte(DynamicType::String);
+        writeString(value.getString());
+        break;
+      case folly::dynamic::Type::ARRAY:
+        writeByte(DynamicType::Array);
+        writeUnsigned(value.size());
+        for (const auto& item : value) {
+          writeDynamic(item);
+        }
+        break;
+      case folly::dynamic::Type::OBJECT:
+        writeByte(DynamicType::Object);
+        writeUnsigned(value.size());
+        for (const auto& [key, item] : value.items()) {
+          writeString(key.asString());
+          writeDynamic(item);
+        }
+        break;
+      case folly::dynamic::Type::NULLT:
+      default:
+        writeByte(DynamicType::Null);
+        break;
+    }
+  }
+
+  void writeNode(const RendererRecording::Node& node) {
+    writeUnsigned(node.id);
+    writeSigned(node.tag);
+  }
+
+  void writeNodes(const std::vector<RendererRecording::Node>& nodes) {
+    writeUnsigned(nodes.size());
+    for (const auto& node : nodes) {
+      writeNode(node);
+    }
+  }
+
+  std::string take() {
+    return std::move(data_);
+  }
+
+ private:
+  std::string data_{};
+  std::unordered_map<std::string, size_t> stringIndices_{};
+};
+
+/*
+ * Reads what `RecordingWriter` wrote. Once the data turns out to be
+ * malformed, all the reads return default values and `hasFailed` returns
+ * `true`.
+ */
+class RecordingReader final {
+ public:
+  explicit RecordingReader(std::string_view data) : data_(data) {}
+
+  bool hasFailed() const {
+    return failed_;
+  }
+
+  bool isAtEnd() const {
+    return position_ == data_.size();
+  }
+
+  bool readMagic() {
+    if (data_.substr(0, kMagic.size()) != kMagic) {
+      failed_ = true;
+      return false;
+    }
+    position_ = kMagic.size();
+    return true;
+  }
+
+  uint8_t readByte() {
+    if (failed_ || position_ >= data_.size()) {
+      failed_ = true;
+      return 0;
+    }
+    return static_cast<uint8_t>(data_[position_++]);
+  }
+
+  uint64_t readUnsigned() {
+    auto value = uint64_t{0};
+    for (int shift = 0; shift < 64; shift += 7) {
+      auto byte = readByte();
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return value;
+      }
+    }
+    failed_ = true;
+    return 0;
+  }
+
+  int64_t readSigned() {
+    auto value = readUnsigned();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  double readDouble() {
+    auto bits = uint64_t{0};
+    for (int i = 0; i < 8; i++) {
+      bits |= static_cast<uint64_t>(readByte()) << (i * 8);
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  // Returns an upper-bounded size of a list, so malformed sizes can't cause
+  // huge allocations (every item takes at least one byte).
+  size_t readSize() {
+    auto size = readUnsigned();
+    if (size > data_.size() - position_) {
+      failed_ = true;
+      return 0;
+    }
+    return static_cast<size_t>(size);
+  }
+
+  std::string readString() {
+    auto reference = readUnsigned();
+    if (reference != 0) {
+      if (reference > strings_.size()) {
+        failed_ = true;
+        return {};
+      }
+      return strings_[reference - 1];
+    }
+
+    auto size = readSize();
+    if (failed_) {
+      return {};
+    }
+    auto& string = strings_.emplace_back(data_.substr(position_, size));
+    position_ += size;
+    return string;
+  }
+
+  folly::dynamic readDynamic(int depth = 0) {
+    if (depth > kMaxDynamicDepth) {
+      failed_ = true;
+      return nullptr;
+    }
+
+    switch (readByte()) {
+      case DynamicType::Null:
+        return nullptr;
+      case DynamicType::False:
+        return false;
+      case DynamicType::True:
+        return true;
+      case DynamicType::Int64:
+        return readSigned();
+      case DynamicType::Double:
+        return readDouble();
+      case DynamicType::String:
+        return readString();
+      case DynamicType::Array: {
+        auto size = readSize();
+        auto array = folly::dynamic::array();
+        for (size_t i = 0; i < size && !failed_; i++) {
+          array.push_back(readDynamic(depth + 1));
+        }
+        return array;
+      }
+      case DynamicType::Object: {
+        auto size = readSize();
+        folly::dynamic object = folly::dynamic::object();
+        for (size_t i = 0; i < size && !failed_; i++) {
+          auto key = readString();
+          object[std::move(key)] = readDynamic(depth + 1);
+        }
+        return object;
+      }
+      default:
+        failed_ = true;
+        return nullptr;
+    }
+  }
+
+  RendererRecording::Node readNode() {
+    auto node = RendererRecording::Node{};
+    node.id = static_cast<RendererRecording::NodeId>(readUnsigned());
+    node.tag = static_cast<Tag>(readSigned());
+    return node;
+  }
+
+  std::vector<RendererRecording::Node> readNodes() {
+    auto size = readSize();
+    auto nodes = std::vector<RendererRecording::Node>{};
+    nodes.reserve(size);
+    for (size_t i = 0; i < size && !failed_; i++) {
+      nodes.push_back(readNode());
+    }
+    return nodes;
+  }
+
+ private:
+  std::string_view data_;
+  size_t position_{0};
+  bool failed_{false};
+  std::vector<std::string> strings_{};
+};
+
+} // namespace
+
+std::string serializeRendererRecording(const RendererRecording& recording) {
+  using Operation = RendererRecording::Operation;
+
+  auto writer = RecordingWriter{};
+  for (auto character : kMagic) {
+    writer.writeByte(static_cast<uint8_t>(character));
+  }
+  writer.writeUnsigned(kVersion);
+  writer.writeUnsigned(recording.operations.size());
+
+  for (const auto& operation : recording.operations) {
+    writer.writeByte(operation.type);
+    writer.writeSigned(operation.surfaceId);
+
+    switch (operation.type) {
+      case Operation::StartSurface: {
+        const auto& layoutConstraints = operation.layoutConstraints;
+        const auto& layoutContext = operation.layoutContext;
+        writer.writeString(operation.name);
+        writer.writeDouble(layoutConstraints.minimumSize.width);
+        writer.writeDouble(layoutConstraints.minimumSize.height);
+        writer.writeDouble(layoutConstraints.maximumSize.width);
+        writer.writeDouble(layoutConstraints.maximumSize.height);
+        writer.writeByte(
+            static_cast<uint8_t>(layoutConstraints.layoutDirection));
+        writer.writeDouble(layoutContext.pointScaleFactor);
+        writer.writeDouble(layoutContext.fontSizeMultiplier);
+        writer.writeByte(layoutContext.swapLeftAndRightInRTL ? 1 : 0);
+        writer.writeDouble(layoutContext.viewportOffset.x);
+        writer.writeDouble(layoutContext.viewportOffset.y);
+        break;
+      }
+      case Operation::StopSurface:
+        break;
+      case Operation::CreateNode:
+        writer.writeNode(operation.node);
+        writer.writeString(operation.name);
+        writer.writeDynamic(operation.props);
+        break;
+      case Operation::CloneNode:
+        writer.writeNode(operation.node);
+        writer.writeNode(operation.sourceNode);
+        writer.writeDynamic(operation.props);
+        writer.writeByte(operation.hasChildren ? 1 : 0);
+        if (operation.hasChildren) {
+          writer.writeNodes(operation.children);
+        }
+        break;
+      case Operation::AppendChild:
+        writer.writeNode(operation.node);
+        writer.writeNode(operation.sourceNode);
+        break;
+      case Operation::CompleteSurface:
+        writer.writeNodes(operation.children);
+        break;
+      case Operation::UpdateState:
+        writer.writeNode(operation.node);
+        writer.writeDynamic(operation.stateData);
+        break;
+      case Operation::Mount:
+        writer.writeUnsigned(operation.surfaceIds.size());
+        for (auto surfaceId : operation.surfaceIds) {
+          writer.writeSigned(surfaceId);
+        }
+        break;
+    }
+  }
+
+  return writer.take();
+}
+
+std::optional<RendererRecording> deserializeRendererRecording(
+    std::string_view data) {
+  using Operation = RendererRecording::Operation;
+
+  auto reader = RecordingReader{data};
+  if (!reader.readMagic()) {
+    LOG(ERROR) << "Renderer recording has an invalid header.";
+    return std::nullopt;
+  }
+
+  auto version = reader.readUnsigned();
+  if (version != kVersion) {
+    LOG(ERROR) << "Renderer recording has unsupported version " << version
+               << ".";
+    return std::nullopt;
+  }
+
+  auto recording = RendererRecording{};
+  auto numberOfOperations = reader.readSize();
+  recording.operations.reserve(numberOfOperations);
+
+  for (size_t i = 0; i < numberOfOperations && !reader.hasFailed(); i++) {
+    auto& operation = recording.operations.emplace_back();
+    operation.type = static_cast<Operation::Type>(reader.readByte());
+    operation.surfaceId = static_cast<SurfaceId>(reader.readSigned());
+
+    switch (operation.type) {
+      case Operation::StartSurface: {
+        auto& layoutConstraints = operation.layoutConstraints;
+        auto& layoutContext = operation.layoutContext;
+        operation.name = reader.readString();
+        layoutConstraints.minimumSize.width = reader.readDouble();
+        layoutConstraints.minimumSize.height = reader.readDouble();
+        layoutConstraints.maximumSize.width = reader.readDouble();
+        layoutConstraints.maximumSize.height = reader.readDouble();
+        layoutConstraints.layoutDirection =
+            static_cast<LayoutDirection>(reader.readByte());
+        layoutContext.pointScaleFactor = reader.readDouble();
+        layoutContext.fontSizeMultiplier = reader.readDouble();
+        layoutContext.swapLeftAndRightInRTL = reader.readByte() != 0;
+        layoutContext.viewportOffset.x = reader.readDouble();
+        layoutContext.viewportOffset.y = reader.readDouble();
+        break;
+      }
+      case Operation::StopSurface:
+        break;
+      case Operation::CreateNode:
+        operation.node = reader.readNode();
+        operation.name = reader.readString();
+        operation.props = reader.readDynamic();
+        break;
+      case Operation::CloneNode:
+        operation.node = reader.readNode();
+        operation.sourceNode = reader.readNode();
+        operation.props = reader.readDynamic();
+        operation.hasChildren = reader.readByte() != 0;
+        if (operation.hasChildren) {
+          operation.children = reader.readNodes();
+        }
+        break;
+      case Operation::AppendChild:
+        operation.node = reader.readNode();
+        operation.sourceNode = reader.readNode();
+        break;
+      case Operation::CompleteSurface:
+        operation.hasChildren = true;
+        operation.children = reader.readNodes();
+        break;
+      case Operation::UpdateState:
+        operation.node = reader.readNode();
+        operation.stateData = reader.readDynamic();
+        break;
+      case Operation::Mount: {
+        auto numberOfSurfaces = reader.readSize();
+        for (size_t j = 0; j < numberOfSurfaces && !reader.hasFailed(); j++) {
+          operation.surfaceIds.push_back(
+              static_cast<SurfaceId>(reader.readSigned()));
+        }
+        break;
+      }
+      default:
+        LOG(ERROR) << "Renderer recording has an unknown operation type "
+                   << static_cast<int>(operation.type) << ".";
+        return std::nullopt;
+    }
+  }
+
+  if (reader.hasFailed() || !reader.isAtEnd()) {
+    LOG(ERROR) << "Renderer recording is truncated or malformed.";
+    return std::nullopt;
+  }
+
+  return recording;
+}
+
+} // namespace facebook::react
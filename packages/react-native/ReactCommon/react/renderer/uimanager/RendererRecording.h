@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/core/LayoutContext.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+namespace facebook::react {
+
+/*
+ * A sequence of operations performed on `UIManager` (by React and by the host
+ * platform), captured by `RendererRecorder` and replayed by
+ * `RendererReplayer`.
+ */
+struct RendererRecording final {
+  /*
+   * Identifies a shadow node instance created by a recorded operation.
+   * Several instances (clones) share the same tag, so operations refer to the
+   * exact instance they were given. `0` identifies instances that were not
+   * created by a recorded operation (e.g. cloned by a native state update);
+   * these are resolved by tag during the replay.
+   */
+  using NodeId = uint32_t;
+
+  struct Node {
+    NodeId id{0};
+    Tag tag{0};
+  };
+
+  struct Operation final {
+    enum Type : uint8_t {
+      StartSurface = 1,
+      StopSurface = 2,
+      CreateNode = 3,
+      CloneNode = 4,
+      AppendChild = 5,
+      CompleteSurface = 6,
+      UpdateState = 7,
+      Mount = 8,
+    };
+
+    Type type{StartSurface};
+    SurfaceId surfaceId{0};
+
+    // The created node (`CreateNode`, `CloneNode`), the parent node
+    // (`AppendChild`) or the node whose state was updated (`UpdateState`).
+    Node node{};
+
+    // The cloned node (`CloneNode`) or the appended child (`AppendChild`).
+    Node sourceNode{};
+
+    // The component name (`CreateNode`) or module name (`StartSurface`).
+    std::string name{};
+
+    // Raw props (`CreateNode`, `CloneNode`). Null if a node was cloned
+    // without new props.
+    folly::dynamic props{nullptr};
+
+    // The new state data, as returned by `State::getDynamic` (`UpdateState`).
+    // Only recorded on Android; null if the data isn't serializable.
+    folly::dynamic stateData{nullptr};
+
+    // New children (`CloneNode`, `CompleteSurface`). `hasChildren` is `false`
+    // if a node was cloned with its current children.
+    bool hasChildren{false};
+    std::vector<Node> children{};
+
+    // Surfaces mounted together (`Mount`).
+    std::vector<SurfaceId> surfaceIds{};
+
+    // Initial layout of the surface (`StartSurface`).
+    LayoutConstraints layoutConstraints{};
+    LayoutContext layoutContext{};
+  };
+
+  std::vector<Operation> operations{};
+};
+
+/*
+ * Encodes a recording into a compact binary representation (repeated strings,
+ * like component names and prop keys, are only stored once).
+ */
+std::string serializeRendererRecording(const RendererRecording& recording);
+
+/*
+ * Decodes a recording encoded by `serializeRendererRecording`. Returns an
+ * empty optional if `data` is malformed.
+ */
+std::optional<RendererRecording> deserializeRendererRecording(
+    std::string_view data);
+
+} // namespace facebook::react
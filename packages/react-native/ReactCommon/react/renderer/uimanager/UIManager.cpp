@@ -14,6 +14,7 @@
 #include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/renderer/mounting/applyStateUpdates.h>
 #include <react/renderer/uimanager/SurfaceRegistryBinding.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
@@ -21,6 +22,7 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace {
@@ -79,6 +81,11 @@ std::shared_ptr<ShadowNode> UIManager::createNode(
 
   PropsParserContext propsParserContext{surfaceId, *contextContainer_.get()};
 
+  // Props are converted for the recorder before being consumed.
+  auto recorder = getRecorder();
+  auto recordedProps =
+      recorder != nullptr ? (folly::dynamic)rawProps : folly::dynamic();
+
   auto family = componentDescriptor.createFamily(
       {tag, surfaceId, std::move(instanceHandle)});
   const auto props = componentDescriptor.cloneProps(
@@ -106,6 +113,9 @@ std::shared_ptr<ShadowNode> UIManager::createNode(
   if (leakChecker_) {
     leakChecker_->uiManagerDidCreateShadowNodeFamily(family);
   }
+  if (recorder != nullptr) {
+    recorder->didCreateNode(shadowNode, std::move(recordedProps));
+  }
 
   return shadowNode;
 }
@@ -124,6 +134,11 @@ std::shared_ptr<ShadowNode> UIManager::cloneNode(
   auto& family = shadowNode.getFamily();
   auto props = ShadowNodeFragment::propsPlaceholder();
 
+  auto recorder = getRecorder();
+  auto recordedProps = recorder != nullptr && !rawProps.isEmpty()
+      ? (folly::dynamic)rawProps
+      : folly::dynamic();
+
   if (!rawProps.isEmpty()) {
     if (family.nativeProps_DEPRECATED != nullptr) {
       // 1. update the nativeProps_DEPRECATED props.
@@ -175,6 +190,11 @@ std::shared_ptr<ShadowNode> UIManager::cloneNode(
           .runtimeShadowNodeReference = false,
       });
 
+  if (recorder != nullptr) {
+    recorder->didCloneNode(
+        shadowNode, clonedShadowNode, children, std::move(recordedProps));
+  }
+
   return clonedShadowNode;
 }
 
@@ -185,6 +205,10 @@ void UIManager::appendChild(
 
   auto& componentDescriptor = parentShadowNode->getComponentDescriptor();
   componentDescriptor.appendChild(parentShadowNode, childShadowNode);
+
+  if (auto recorder = getRecorder()) {
+    recorder->didAppendChild(*parentShadowNode, *childShadowNode);
+  }
 }
 
 void UIManager::completeSurface(
@@ -193,10 +217,14 @@ void UIManager::completeSurface(
     ShadowTree::CommitOptions commitOptions) {
   SystraceSection s("UIManager::completeSurface", "surfaceId", surfaceId);
 
+  if (auto recorder = getRecorder()) {
+    recorder->didCompleteSurface(surfaceId, *rootChildren);
+  }
+
   shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
     auto result = shadowTree.commit(
         [&](const RootShadowNode& oldRootShadowNode) {
-          return std::make_shared<RootShadowNode>(
+          return makeSharedShadowNode<RootShadowNode>(
               oldRootShadowNode,
               ShadowNodeFragment{
                   .props = ShadowNodeFragment::propsPlaceholder(),
@@ -233,6 +261,17 @@ void UIManager::startSurface(
   SystraceSection s("UIManager::startSurface");
 
   auto surfaceId = shadowTree->getSurfaceId();
+
+  if (auto recorder = getRecorder()) {
+    const auto& rootProps =
+        shadowTree->getCurrentRevision().rootShadowNode->getConcreteProps();
+    recorder->didStartSurface(
+        surfaceId,
+        moduleName,
+        rootProps.layoutConstraints,
+        rootProps.layoutContext);
+  }
+
   shadowTreeRegistry_.add(std::move(shadowTree));
 
   runtimeExecutor_([=](jsi::Runtime& runtime) {
@@ -265,6 +304,10 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
   // `ShadowTree`.
   auto shadowTree = getShadowTreeRegistry().remove(surfaceId);
   if (shadowTree) {
+    if (auto recorder = getRecorder()) {
+      recorder->didStopSurface(surfaceId);
+    }
+
     // We execute JavaScript/React part of the process at the very end to
     // minimize any visible side-effects of stopping the Surface. Any possible
     // commits from the JavaScript side will not be able to reference a
@@ -282,12 +325,26 @@ ShadowTree::Unique UIManager::stopSurface(SurfaceId surfaceId) const {
 
 ShadowNode::Shared UIManager::getNewestCloneOfShadowNode(
     const ShadowNode& shadowNode) const {
-  auto ancestorShadowNode = ShadowNode::Shared{};
+  auto newestShadowNode = ShadowNode::Shared{};
   shadowTreeRegistry_.visit(
       shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
-        ancestorShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        newestShadowNode = shadowTree.findShadowNodeByTag(shadowNode.getTag());
+        if (!newestShadowNode) {
+          // The root node is not indexed.
+          auto rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+          if (ShadowNode::sameFamily(*rootShadowNode, shadowNode)) {
+            newestShadowNode = rootShadowNode;
+          }
+        }
       });
-  return getShadowNodeInSubtree(shadowNode, ancestorShadowNode);
+
+  if (newestShadowNode &&
+      !ShadowNode::sameFamily(*newestShadowNode, shadowNode)) {
+    // The tag was reused by a different node.
+    return nullptr;
+  }
+
+  return newestShadowNode;
 }
 
 ShadowNode::Shared UIManager::getShadowNodeInSubtree(
@@ -379,48 +436,54 @@ void UIManager::updateState(const StateUpdate& stateUpdate) const {
       "UIManager::updateState",
       "componentName",
       stateUpdate.family->getComponentName());
-  auto& callback = stateUpdate.callback;
-  auto& family = stateUpdate.family;
-  auto& componentDescriptor = family->getComponentDescriptor();
-  auto clonedByNativeStateTraits = ShadowNodeTraits();
-  clonedByNativeStateTraits.set(
-      ShadowNodeTraits::Trait::ClonedByNativeStateUpdate);
 
-  shadowTreeRegistry_.visit(
-      family->getSurfaceId(), [&](const ShadowTree& shadowTree) {
-        shadowTree.commit(
-            [&](const RootShadowNode& oldRootShadowNode) {
-              auto isValid = true;
+  if (auto recorder = getRecorder()) {
+    recorder->didUpdateStates({stateUpdate});
+  }
 
-              auto rootNode = oldRootShadowNode.cloneTree(
-                  *family,
-                  [&](const ShadowNode& oldShadowNode) {
-                    auto newData =
-                        callback(oldShadowNode.getState()->getDataPointer());
-
-                    if (!newData) {
-                      isValid = false;
-                      // Just return something, we will discard it anyway.
-                      return oldShadowNode.clone({});
-                    }
-
-                    auto newState =
-                        componentDescriptor.createState(*family, newData);
-
-                    return oldShadowNode.clone(
-                        {.props = ShadowNodeFragment::propsPlaceholder(),
-                         .children = ShadowNodeFragment::childrenPlaceholder(),
-                         .state = newState,
-                         .traits = clonedByNativeStateTraits});
-                  },
-                  clonedByNativeStateTraits);
-
-              return isValid
-                  ? std::static_pointer_cast<RootShadowNode>(rootNode)
-                  : nullptr;
-            },
-            {/* default commit options */});
-      });
+  commitStateUpdates(stateUpdate.family->getSurfaceId(), {stateUpdate});
+}
+
+void UIManager::updateStates(
+    const std::vector<StateUpdate>& stateUpdates) const {
+  SystraceSection s("UIManager::updateStates");
+
+  if (auto recorder = getRecorder()) {
+    recorder->didUpdateStates(stateUpdates);
+  }
+
+  // Surfaces are few, so a linear lookup is cheaper than a map here.
+  auto stateUpdatesBySurface =
+      std::vector<std::pair<SurfaceId, std::vector<StateUpdate>>>{};
+  for (const auto& stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    auto it = std::find_if(
+        stateUpdatesBySurface.begin(),
+        stateUpdatesBySurface.end(),
+        [&](const auto& entry) { return entry.first == surfaceId; });
+    if (it == stateUpdatesBySurface.end()) {
+      stateUpdatesBySurface.emplace_back(
+          surfaceId, std::vector<StateUpdate>{stateUpdate});
+    } else {
+      it->second.push_back(stateUpdate);
+    }
+  }
+
+  for (const auto& [surfaceId, surfaceStateUpdates] : stateUpdatesBySurface) {
+    commitStateUpdates(surfaceId, surfaceStateUpdates);
+  }
+}
+
+void UIManager::commitStateUpdates(
+    SurfaceId surfaceId,
+    const std::vector<StateUpdate>& stateUpdates) const {
+  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+    shadowTree.commit(
+        [&](const RootShadowNode& oldRootShadowNode) {
+          return applyStateUpdates(oldRootShadowNode, stateUpdates);
+        },
+        {/* default commit options */});
+  });
 }
 
 void UIManager::dispatchCommand(
@@ -503,51 +566,13 @@ void UIManager::configureNextLayoutAnimation(
   }
 }
 
-static ShadowNode::Shared findShadowNodeByTagRecursively(
-    ShadowNode::Shared parentShadowNode,
-    Tag tag) {
-  if (parentShadowNode->getTag() == tag) {
-    return parentShadowNode;
-  }
-
-  for (const ShadowNode::Shared& shadowNode : parentShadowNode->getChildren()) {
-    auto result = findShadowNodeByTagRecursively(shadowNode, tag);
-    if (result) {
-      return result;
-    }
-  }
-
-  return nullptr;
-}
-
 ShadowNode::Shared UIManager::findShadowNodeByTag_DEPRECATED(Tag tag) const {
   auto shadowNode = ShadowNode::Shared{};
 
   shadowTreeRegistry_.enumerate([&](const ShadowTree& shadowTree, bool& stop) {
-    const RootShadowNode* rootShadowNode;
-    // The public interface of `ShadowTree` discourages accessing a stored
-    // pointer to a root node because of the possible data race.
-    // To work around this, we ask for a commit and immediately cancel it
-    // returning `nullptr` instead of a new shadow tree.
-    // We don't want to add a way to access a stored pointer to a root node
-    // because this `findShadowNodeByTag` is deprecated. It is only added
-    // to make migration to the new architecture easier.
-    shadowTree.tryCommit(
-        [&](const RootShadowNode& oldRootShadowNode) {
-          rootShadowNode = &oldRootShadowNode;
-          return nullptr;
-        },
-        {/* default commit options */});
-
-    if (rootShadowNode != nullptr) {
-      const auto& children = rootShadowNode->getChildren();
-      if (!children.empty()) {
-        const auto& child = children.front();
-        shadowNode = findShadowNodeByTagRecursively(child, tag);
-        if (shadowNode) {
-          stop = true;
-        }
-      }
+    shadowNode = shadowTree.findShadowNodeByTag(tag);
+    if (shadowNode) {
+      stop = true;
     }
   });
 
@@ -614,6 +639,22 @@ void UIManager::unregisterMountHook(UIManagerMountHook& mountHook) {
   mountHooks_.erase(iterator);
 }
 
+void UIManager::setRecorder(std::shared_ptr<RendererRecorder> recorder) {
+  auto hasRecorder = recorder != nullptr;
+  std::atomic_store_explicit(
+      &recorder_, std::move(recorder), std::memory_order_release);
+  hasRecorder_.store(hasRecorder, std::memory_order_relaxed);
+}
+
+std::shared_ptr<RendererRecorder> UIManager::getRecorder() const {
+  // Operations running concurrently with `setRecorder` may or may not be
+  // recorded either way.
+  if (!hasRecorder_.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return std::atomic_load_explicit(&recorder_, std::memory_order_acquire);
+}
+
 #pragma mark - ShadowTreeDelegate
 
 RootShadowNode::Unshared UIManager::shadowTreeWillCommit(
@@ -645,25 +686,33 @@ void UIManager::shadowTreeDidFinishTransaction(
 }
 
 void UIManager::reportMount(SurfaceId surfaceId) const {
-  SystraceSection s("UIManager::reportMount");
+  reportMounts({surfaceId});
+}
+
+void UIManager::reportMounts(const std::vector<SurfaceId>& surfaceIds) const {
+  SystraceSection s("UIManager::reportMounts");
+
+  if (auto recorder = getRecorder()) {
+    recorder->didMount(surfaceIds);
+  }
 
   auto time = JSExecutor::performanceNow();
 
-  auto rootShadowNode = RootShadowNode::Shared{};
-  shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
-    rootShadowNode =
-        shadowTree.getMountingCoordinator()->getBaseRevision().rootShadowNode;
-  });
+  auto mountSummaries = std::vector<MountSummary>{};
+  mountSummaries.reserve(surfaceIds.size());
+  for (auto surfaceId : surfaceIds) {
+    auto& mountSummary = mountSummaries.emplace_back();
+    mountSummary.surfaceId = surfaceId;
+    shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+      mountSummary = shadowTree.getMountingCoordinator()->takeMountSummary();
+    });
+  }
 
   {
     std::shared_lock lock(mountHookMutex_);
 
     for (auto* mountHook : mountHooks_) {
-      if (rootShadowNode) {
-        mountHook->shadowTreeDidMount(rootShadowNode, time);
-      } else {
-        mountHook->shadowTreeDidUnmount(surfaceId, time);
-      }
+      mountHook->shadowTreesDidMount(mountSummaries, time);
     }
   }
 }
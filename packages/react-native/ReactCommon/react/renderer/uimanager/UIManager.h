@@ -11,6 +11,7 @@
 #include <jsi/jsi.h>
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <atomic>
 #include <shared_mutex>
 
 #include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
@@ -23,6 +24,7 @@
 #include <react/renderer/mounting/ShadowTree.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
 #include <react/renderer/mounting/ShadowTreeRegistry.h>
+#include <react/renderer/uimanager/RendererRecorder.h>
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
 #include <react/renderer/uimanager/UIManagerDelegate.h>
 #include <react/renderer/uimanager/consistency/LatestShadowTreeRevisionProvider.h>
@@ -93,6 +95,12 @@ class UIManager final : public ShadowTreeDelegate {
   void registerMountHook(UIManagerMountHook& mountHook);
   void unregisterMountHook(UIManagerMountHook& mountHook);
 
+  /*
+   * Sets (or, with `nullptr`, removes) a recorder capturing the operations
+   * performed on this `UIManager`. Can be called from any thread.
+   */
+  void setRecorder(std::shared_ptr<RendererRecorder> recorder);
+
   ShadowNode::Shared getNewestCloneOfShadowNode(
       const ShadowNode& shadowNode) const;
 
@@ -173,6 +181,12 @@ class UIManager final : public ShadowTreeDelegate {
    */
   void updateState(const StateUpdate& stateUpdate) const;
 
+  /*
+   * Same as `updateState` for a batch of updates, but performs only one
+   * commit per affected surface.
+   */
+  void updateStates(const std::vector<StateUpdate>& stateUpdates) const;
+
   void dispatchCommand(
       const ShadowNode::Shared& shadowNode,
       const std::string& commandName,
@@ -198,6 +212,12 @@ class UIManager final : public ShadowTreeDelegate {
 
   void reportMount(SurfaceId surfaceId) const;
 
+  /*
+   * Notifies the mount hooks once for all the surfaces that were mounted
+   * (e.g. in the same frame).
+   */
+  void reportMounts(const std::vector<SurfaceId>& surfaceIds) const;
+
  private:
   friend class UIManagerBinding;
   friend class Scheduler;
@@ -217,6 +237,12 @@ class UIManager final : public ShadowTreeDelegate {
       const ShadowNode& shadowNode,
       const ShadowNode::Shared& ancestorShadowNode) const;
 
+  void commitStateUpdates(
+      SurfaceId surfaceId,
+      const std::vector<StateUpdate>& stateUpdates) const;
+
+  std::shared_ptr<RendererRecorder> getRecorder() const;
+
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   UIManagerDelegate* delegate_{};
   UIManagerAnimationDelegate* animationDelegate_{nullptr};
@@ -230,6 +256,11 @@ class UIManager final : public ShadowTreeDelegate {
   mutable std::shared_mutex mountHookMutex_;
   mutable std::vector<UIManagerMountHook*> mountHooks_;
 
+  std::shared_ptr<RendererRecorder> recorder_; // Accessed atomically.
+  // Lets `getRecorder` skip the load of `recorder_` (which isn't lock-free)
+  // while nothing is recorded, which is almost always.
+  std::atomic<bool> hasRecorder_{false};
+
   std::unique_ptr<LeakChecker> leakChecker_;
 
   std::unique_ptr<LazyShadowTreeRevisionConsistencyManager>
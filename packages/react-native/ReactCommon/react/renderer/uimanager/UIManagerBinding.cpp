@@ -65,8 +65,7 @@ UIManagerBinding::~UIManagerBinding() {
 jsi::Value UIManagerBinding::getInspectorDataForInstance(
     jsi::Runtime& runtime,
     const EventEmitter& eventEmitter) const {
-  auto eventTarget = eventEmitter.eventTarget_;
-  EventEmitter::DispatchMutex().lock();
+  auto eventTarget = eventEmitter.getEventTarget();
 
   if (!runtime.global().hasProperty(runtime, "__fbBatchedBridge") ||
       !eventTarget) {
@@ -76,7 +75,6 @@ jsi::Value UIManagerBinding::getInspectorDataForInstance(
   eventTarget->retain(runtime);
   auto instanceHandle = eventTarget->getInstanceHandle(runtime);
   eventTarget->release(runtime);
-  EventEmitter::DispatchMutex().unlock();
 
   if (instanceHandle.isUndefined()) {
     return jsi::Value::undefined();
@@ -312,13 +310,15 @@ jsi::Value UIManagerBinding::get(
             return jsi::Value::undefined();
           }
 
-          auto& eventTarget = targetNode->getEventEmitter()->eventTarget_;
+          auto eventTarget = targetNode->getEventEmitter()->getEventTarget();
+          if (!eventTarget) {
+            onSuccessFunction.call(runtime, jsi::Value::null());
+            return jsi::Value::undefined();
+          }
 
-          EventEmitter::DispatchMutex().lock();
           eventTarget->retain(runtime);
           auto instanceHandle = eventTarget->getInstanceHandle(runtime);
           eventTarget->release(runtime);
-          EventEmitter::DispatchMutex().unlock();
 
           onSuccessFunction.call(runtime, std::move(instanceHandle));
           return jsi::Value::undefined();
@@ -435,8 +435,9 @@ jsi::Value UIManagerBinding::get(
            const jsi::Value& /*thisValue*/,
            const jsi::Value* /*arguments*/,
            size_t /*count*/) -> jsi::Value {
-          auto shadowNodeList = std::make_shared<ShadowNode::ListOfShared>(
-              ShadowNode::ListOfShared({}));
+          auto shadowNodeList =
+              makeSharedChildrenList<ShadowNode::ListOfShared>(
+                  ShadowNode::ListOfShared({}));
           return valueFromShadowNodeList(runtime, shadowNodeList);
         });
   }
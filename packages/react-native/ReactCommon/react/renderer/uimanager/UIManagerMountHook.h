@@ -8,8 +8,12 @@
 #pragma once
 
 #include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/MountSummary.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
 #include "UIManager.h"
 
+#include <vector>
+
 namespace facebook::react {
 
 class ShadowTree;
@@ -21,12 +25,54 @@ class UIManager;
  */
 class UIManagerMountHook {
  public:
+  /*
+   * Called once per batch of mounts reported by the host platform (normally
+   * once per frame) with a summary of what was mounted in each surface.
+   * The default implementation calls the per-surface methods below for each
+   * summary. Hooks observing several surfaces should override this method
+   * instead, to process all of them at once without looking up the mounted
+   * revisions.
+   */
+  virtual void shadowTreesDidMount(
+      const std::vector<MountSummary>& mountSummaries,
+      double mountTime) noexcept {
+    for (const auto& mountSummary : mountSummaries) {
+      if (mountSummary.rootShadowNode == nullptr) {
+        shadowTreeDidUnmount(mountSummary.surfaceId, mountTime);
+        continue;
+      }
+
+      if (!mountSummary.eventTransactionTelemetries.empty()) {
+        shadowTreeDidMountEventTransactions(
+            mountSummary.surfaceId,
+            mountSummary.eventTransactionTelemetries,
+            mountTime);
+      }
+
+      shadowTreeDidMount(mountSummary.rootShadowNode, mountTime);
+    }
+  }
+
   /*
    * Called right after a `ShadowTree` is mounted in the host platform.
    */
   virtual void shadowTreeDidMount(
-      const RootShadowNode::Shared& rootShadowNode,
-      double mountTime) noexcept = 0;
+      const RootShadowNode::Shared& /*rootShadowNode*/,
+      double /*mountTime*/) noexcept {
+    // Default no-op implementation for hooks overriding `shadowTreesDidMount`.
+  }
+
+  /*
+   * Called right before `shadowTreeDidMount` with the telemetry of the
+   * mounted transactions that were caused by input events (see
+   * `EventCausality.h`). Not called if there were none.
+   */
+  virtual void shadowTreeDidMountEventTransactions(
+      SurfaceId /*surfaceId*/,
+      const std::vector<TransactionTelemetry>& /*transactionTelemetries*/,
+      double /*mountTime*/) noexcept {
+    // Default no-op implementation for backwards compatibility.
+  }
 
   virtual void shadowTreeDidUnmount(
       SurfaceId /*surfaceId*/,
@@ -71,7 +71,8 @@ inline static ShadowNode::UnsharedListOfShared shadowNodeListFromValue(
     auto jsArray = std::move(object).asArray(runtime);
     size_t jsArrayLen = jsArray.length(runtime);
     if (jsArrayLen > 0) {
-      auto shadowNodeArray = std::make_shared<ShadowNode::ListOfShared>();
+      auto shadowNodeArray =
+          makeSharedChildrenList<ShadowNode::ListOfShared>();
       shadowNodeArray->reserve(jsArrayLen);
 
       for (size_t i = 0; i < jsArrayLen; i++) {
@@ -81,7 +82,7 @@ inline static ShadowNode::UnsharedListOfShared shadowNodeListFromValue(
       return shadowNodeArray;
     } else {
       // TODO: return ShadowNode::emptySharedShadowNodeSharedList()
-      return std::make_shared<ShadowNode::ListOfShared>(
+      return makeSharedChildrenList<ShadowNode::ListOfShared>(
           ShadowNode::ListOfShared({}));
       ;
     }
@@ -105,7 +106,7 @@ inline static jsi::Value valueFromShadowNodeList(
 
 inline static ShadowNode::UnsharedListOfShared shadowNodeListFromWeakList(
     const ShadowNode::UnsharedListOfWeak& weakShadowNodeList) {
-  auto result = std::make_shared<ShadowNode::ListOfShared>();
+  auto result = makeSharedChildrenList<ShadowNode::ListOfShared>();
   for (const auto& weakShadowNode : *weakShadowNodeList) {
     auto sharedShadowNode = weakShadowNode.lock();
     if (!sharedShadowNode) {
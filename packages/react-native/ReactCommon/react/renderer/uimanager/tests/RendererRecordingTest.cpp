@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/uimanager/RendererRecorder.h>
+#include <react/renderer/uimanager/RendererRecording.h>
+#include <react/renderer/uimanager/UIManager.h>
+
+namespace facebook::react {
+
+using Operation = RendererRecording::Operation;
+
+static RendererRecording makeRecording() {
+  auto recording = RendererRecording{};
+
+  auto startSurface = Operation{};
+  startSurface.type = Operation::StartSurface;
+  startSurface.surfaceId = 11;
+  startSurface.name = "ProfileScreen";
+  startSurface.layoutConstraints = {
+      .minimumSize = {0, 0},
+      .maximumSize = {390, 844},
+      .layoutDirection = LayoutDirection::RightToLeft};
+  startSurface.layoutContext.pointScaleFactor = 3;
+  startSurface.layoutContext.fontSizeMultiplier = 1.25;
+  startSurface.layoutContext.viewportOffset = {0, -20};
+  recording.operations.push_back(startSurface);
+
+  auto createNode = Operation{};
+  createNode.type = Operation::CreateNode;
+  createNode.surfaceId = 11;
+  createNode.node = {1, 42};
+  createNode.name = "View";
+  createNode.props = folly::dynamic::object("nativeID", "header")(
+      "opacity", 0.5)("zIndex", -3)("collapsable", false)(
+      "transform", folly::dynamic::array(folly::dynamic::object("scale", 2)))(
+      "hitSlop", nullptr);
+  recording.operations.push_back(createNode);
+
+  auto cloneNode = Operation{};
+  cloneNode.type = Operation::CloneNode;
+  cloneNode.surfaceId = 11;
+  cloneNode.node = {2, 42};
+  cloneNode.sourceNode = {1, 42};
+  cloneNode.props = folly::dynamic::object("nativeID", "footer");
+  cloneNode.hasChildren = true;
+  cloneNode.children = {{3, 44}, {0, 46}};
+  recording.operations.push_back(cloneNode);
+
+  auto completeSurface = Operation{};
+  completeSurface.type = Operation::CompleteSurface;
+  completeSurface.surfaceId = 11;
+  completeSurface.hasChildren = true;
+  completeSurface.children = {{2, 42}};
+  recording.operations.push_back(completeSurface);
+
+  auto updateState = Operation{};
+  updateState.type = Operation::UpdateState;
+  updateState.surfaceId = 11;
+  updateState.node = {0, 46};
+  updateState.stateData = folly::dynamic::object("contentOffsetLeft", 0)(
+      "contentOffsetTop", 120.5);
+  recording.operations.push_back(updateState);
+
+  auto mount = Operation{};
+  mount.type = Operation::Mount;
+  mount.surfaceIds = {11, 21};
+  recording.operations.push_back(mount);
+
+  auto stopSurface = Operation{};
+  stopSurface.type = Operation::StopSurface;
+  stopSurface.surfaceId = 11;
+  recording.operations.push_back(stopSurface);
+
+  return recording;
+}
+
+static void expectEqualNodes(
+    const RendererRecording::Node& lhs,
+    const RendererRecording::Node& rhs) {
+  EXPECT_EQ(lhs.id, rhs.id);
+  EXPECT_EQ(lhs.tag, rhs.tag);
+}
+
+TEST(RendererRecordingTest, serializedRecordingCanBeDeserialized) {
+  auto recording = makeRecording();
+
+  auto data = serializeRendererRecording(recording);
+  auto deserializedRecording = deserializeRendererRecording(data);
+
+  ASSERT_TRUE(deserializedRecording.has_value());
+  ASSERT_EQ(
+      deserializedRecording->operations.size(), recording.operations.size());
+
+  for (size_t i = 0; i < recording.operations.size(); i++) {
+    const auto& expected = recording.operations[i];
+    const auto& actual = deserializedRecording->operations[i];
+
+    EXPECT_EQ(actual.type, expected.type);
+    EXPECT_EQ(actual.surfaceId, expected.surfaceId);
+    expectEqualNodes(actual.node, expected.node);
+    expectEqualNodes(actual.sourceNode, expected.sourceNode);
+    EXPECT_EQ(actual.name, expected.name);
+    EXPECT_EQ(actual.props, expected.props);
+    EXPECT_EQ(actual.stateData, expected.stateData);
+    EXPECT_EQ(actual.hasChildren, expected.hasChildren);
+    ASSERT_EQ(actual.children.size(), expected.children.size());
+    for (size_t j = 0; j < expected.children.size(); j++) {
+      expectEqualNodes(actual.children[j], expected.children[j]);
+    }
+    EXPECT_EQ(actual.surfaceIds, expected.surfaceIds);
+  }
+
+  const auto& startSurface = deserializedRecording->operations[0];
+  EXPECT_EQ(
+      startSurface.layoutConstraints,
+      recording.operations[0].layoutConstraints);
+  EXPECT_EQ(startSurface.layoutContext.pointScaleFactor, 3);
+  EXPECT_EQ(startSurface.layoutContext.fontSizeMultiplier, 1.25);
+  EXPECT_EQ(
+      startSurface.layoutContext.viewportOffset, (Point{.x = 0, .y = -20}));
+}
+
+TEST(RendererRecordingTest, repeatedStringsAreStoredOnce) {
+  auto recording = RendererRecording{};
+  for (int i = 0; i < 100; i++) {
+    auto operation = Operation{};
+    operation.type = Operation::CreateNode;
+    operation.node = {static_cast<RendererRecording::NodeId>(i + 1), i * 2};
+    operation.name = "RCTSomeVeryLongComponentName";
+    operation.props = folly::dynamic::object(
+        "someVeryLongPropName", "someVeryLongPropValue");
+    recording.operations.push_back(std::move(operation));
+  }
+
+  auto data = serializeRendererRecording(recording);
+
+  EXPECT_LT(data.size(), 100 * 16);
+}
+
+TEST(RendererRecordingTest, malformedDataIsRejected) {
+  auto data = serializeRendererRecording(makeRecording());
+
+  EXPECT_FALSE(deserializeRendererRecording("").has_value());
+  EXPECT_FALSE(deserializeRendererRecording("not a recording").has_value());
+  for (size_t size = 0; size < data.size(); size++) {
+    EXPECT_FALSE(deserializeRendererRecording(std::string_view(data).substr(
+                                                  0, size))
+                     .has_value());
+  }
+}
+
+class RendererRecorderTest : public ::testing::Test {
+ public:
+  RendererRecorderTest() {
+    auto contextContainer = std::make_shared<ContextContainer>();
+
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<RootComponentDescriptor>());
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    auto componentDescriptorRegistry =
+        providerRegistry_.createComponentDescriptorRegistry(
+            ComponentDescriptorParameters{
+                EventDispatcher::Shared{}, contextContainer, nullptr});
+
+    RuntimeExecutor runtimeExecutor =
+        [](std::function<void(facebook::jsi::Runtime & runtime)>&& callback) {};
+    uiManager_ = std::make_unique<UIManager>(runtimeExecutor, contextContainer);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry);
+
+    recorder_ = std::make_shared<RendererRecorder>();
+    uiManager_->setRecorder(recorder_);
+  }
+
+ protected:
+  ComponentDescriptorProviderRegistry providerRegistry_{};
+  std::unique_ptr<UIManager> uiManager_;
+  std::shared_ptr<RendererRecorder> recorder_;
+};
+
+TEST_F(RendererRecorderTest, operationsReferToTheNodesTheyWereGiven) {
+  folly::dynamic props = folly::dynamic::object("nativeID", "parent");
+  auto parent = uiManager_->createNode(2, "View", 1, RawProps(props), nullptr);
+  auto child = uiManager_->createNode(
+      4, "View", 1, RawProps(folly::dynamic::object()), nullptr);
+  uiManager_->appendChild(parent, child);
+
+  folly::dynamic newProps = folly::dynamic::object("opacity", 0.5);
+  auto clonedParent =
+      uiManager_->cloneNode(*parent, nullptr, RawProps(newProps));
+  auto clonedChild = uiManager_->cloneNode(*child, nullptr, RawProps());
+  auto reparentedChild = uiManager_->cloneNode(
+      *clonedParent,
+      std::make_shared<ShadowNode::ListOfShared>(
+          ShadowNode::ListOfShared{clonedChild}),
+      RawProps());
+
+  auto recording = recorder_->takeRecording();
+  const auto& operations = recording.operations;
+
+  ASSERT_EQ(operations.size(), 6);
+
+  EXPECT_EQ(operations[0].type, Operation::CreateNode);
+  EXPECT_EQ(operations[0].surfaceId, 1);
+  EXPECT_EQ(operations[0].name, "View");
+  EXPECT_EQ(operations[0].props, props);
+  auto parentId = operations[0].node.id;
+  EXPECT_EQ(operations[0].node.tag, 2);
+
+  EXPECT_EQ(operations[1].type, Operation::CreateNode);
+  auto childId = operations[1].node.id;
+  EXPECT_NE(childId, parentId);
+
+  EXPECT_EQ(operations[2].type, Operation::AppendChild);
+  EXPECT_EQ(operations[2].node.id, parentId);
+  EXPECT_EQ(operations[2].sourceNode.id, childId);
+
+  EXPECT_EQ(operations[3].type, Operation::CloneNode);
+  EXPECT_EQ(operations[3].sourceNode.id, parentId);
+  EXPECT_EQ(operations[3].props, newProps);
+  EXPECT_FALSE(operations[3].hasChildren);
+  auto clonedParentId = operations[3].node.id;
+  EXPECT_NE(clonedParentId, parentId);
+  EXPECT_EQ(operations[3].node.tag, 2);
+
+  EXPECT_EQ(operations[4].type, Operation::CloneNode);
+  EXPECT_EQ(operations[4].sourceNode.id, childId);
+  EXPECT_TRUE(operations[4].props.isNull());
+  auto clonedChildId = operations[4].node.id;
+
+  EXPECT_EQ(operations[5].type, Operation::CloneNode);
+  EXPECT_EQ(operations[5].sourceNode.id, clonedParentId);
+  EXPECT_TRUE(operations[5].hasChildren);
+  ASSERT_EQ(operations[5].children.size(), 1);
+  EXPECT_EQ(operations[5].children[0].id, clonedChildId);
+
+  EXPECT_TRUE(recorder_->takeRecording().operations.empty());
+}
+
+TEST_F(RendererRecorderTest, nothingIsRecordedOnceTheRecorderIsRemoved) {
+  uiManager_->setRecorder(nullptr);
+
+  uiManager_->createNode(
+      2, "View", 1, RawProps(folly::dynamic::object()), nullptr);
+
+  EXPECT_TRUE(recorder_->takeRecording().operations.empty());
+}
+
+} // namespace facebook::react
@@ -8,52 +8,119 @@
 #include "BufferedRuntimeExecutor.h"
 
 #include <algorithm>
+#include <iterator>
 
 namespace facebook::react {
 
 BufferedRuntimeExecutor::BufferedRuntimeExecutor(
     RuntimeExecutor runtimeExecutor)
-    : runtimeExecutor_(runtimeExecutor),
-      isBufferingEnabled_(true),
-      lastIndex_(0) {}
+    : runtimeExecutor_(std::move(runtimeExecutor)) {}
 
-void BufferedRuntimeExecutor::execute(Work&& callback) {
-  if (!isBufferingEnabled_) {
-    // Fast path: Schedule directly to RuntimeExecutor, without locking
+BufferedRuntimeExecutor::~BufferedRuntimeExecutor() {
+  auto node = head_.load(std::memory_order_acquire);
+  while (node != nullptr && node != &flushing_ && node != &closed_) {
+    auto next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+void BufferedRuntimeExecutor::execute(
+    Work&& callback,
+    SchedulerPriority priority) {
+  auto head = head_.load(std::memory_order_acquire);
+  if (head == &closed_) {
+    // Fast path: Schedule directly to RuntimeExecutor, without allocating
     runtimeExecutor_(std::move(callback));
     return;
   }
 
-  /**
-   * Note: std::mutex doesn't have a FIFO ordering.
-   * To preserve the order of the buffered work, use a priority queue and
-   * track the last known work index.
-   */
-  uint64_t newIndex = lastIndex_++;
-  std::scoped_lock guard(lock_);
-  if (isBufferingEnabled_) {
-    queue_.push({.index_ = newIndex, .work_ = std::move(callback)});
-    return;
+  auto node = new BufferedWork{std::move(callback), priority, head};
+  while (!head_.compare_exchange_weak(
+      node->next,
+      node,
+      std::memory_order_release,
+      std::memory_order_acquire)) {
+    if (node->next == &closed_) {
+      // `flush` finished in the meantime, so everything buffered before has
+      // already been handed to the RuntimeExecutor.
+      runtimeExecutor_(std::move(node->work));
+      delete node;
+      return;
+    }
   }
+}
+
+void BufferedRuntimeExecutor::flush() {
+  std::scoped_lock guard(flushMutex_);
 
-  // Force flush the queue to maintain the execution order.
-  unsafeFlush();
+  auto head = head_.load(std::memory_order_acquire);
+  while (head != &closed_) {
+    if (head == nullptr || head == &flushing_) {
+      // Nothing left to replay. Buffering is only disabled if no new work was
+      // pushed concurrently, otherwise that work is replayed first so it
+      // can't be overtaken by work that goes to the RuntimeExecutor directly.
+      head_.compare_exchange_weak(
+          head, &closed_, std::memory_order_acq_rel, std::memory_order_acquire);
+      continue;
+    }
 
-  runtimeExecutor_(std::move(callback));
+    if (head_.compare_exchange_weak(
+            head,
+            &flushing_,
+            std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+      flushList(head);
+      head = head_.load(std::memory_order_acquire);
+    }
+  }
 }
 
-void BufferedRuntimeExecutor::flush() {
-  std::scoped_lock guard(lock_);
-  unsafeFlush();
-  isBufferingEnabled_ = false;
+void BufferedRuntimeExecutor::flushList(BufferedWork* head) {
+  std::vector<BufferedWork*> nodes;
+  for (auto node = head; node != nullptr && node != &flushing_;
+       node = node->next) {
+    nodes.push_back(node);
+  }
+
+  // The list is newest first; restore submission order, then move higher
+  // priorities (lower values) to the front while keeping that order within
+  // each priority.
+  std::reverse(nodes.begin(), nodes.end());
+  std::stable_sort(nodes.begin(), nodes.end(), [](auto lhs, auto rhs) {
+    return lhs->priority < rhs->priority;
+  });
+
+  std::vector<Work> batch;
+  batch.reserve(nodes.size());
+  for (auto node : nodes) {
+    batch.push_back(std::move(node->work));
+    delete node;
+  }
+
+  runtimeExecutor_([runtimeExecutor = runtimeExecutor_,
+                    batch = std::move(batch)](jsi::Runtime& runtime) mutable {
+    for (size_t index = 0; index < batch.size(); index++) {
+      try {
+        batch[index](runtime);
+      } catch (...) {
+        // Don't drop the rest of the batch because of one failing call.
+        executeSeparately(
+            runtimeExecutor,
+            std::vector<Work>(
+                std::make_move_iterator(batch.begin() + index + 1),
+                std::make_move_iterator(batch.end())));
+        throw;
+      }
+    }
+  });
 }
 
-void BufferedRuntimeExecutor::unsafeFlush() {
-  while (queue_.size() > 0) {
-    const BufferedWork& bufferedWork = queue_.top();
-    Work work = std::move(bufferedWork.work_);
-    runtimeExecutor_(std::move(work));
-    queue_.pop();
+void BufferedRuntimeExecutor::executeSeparately(
+    const RuntimeExecutor& runtimeExecutor,
+    std::vector<Work>&& batch) {
+  for (auto& work : batch) {
+    runtimeExecutor(std::move(work));
   }
 }
 
@@ -8,43 +8,73 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <ReactCommon/SchedulerPriority.h>
 #include <jsi/jsi.h>
 #include <atomic>
-#include <queue>
+#include <mutex>
+#include <vector>
 
 namespace facebook::react {
 
+/*
+ * Buffers work until `flush` is called and then forwards everything to the
+ * given `RuntimeExecutor`.
+ *
+ * Buffering is lock-free: work is pushed onto an atomic singly-linked list.
+ * `flush` replays all buffered work in a single entry into the runtime,
+ * ordered by priority lane and, within a lane, in the order it was submitted.
+ * Once flushed, work goes straight to the `RuntimeExecutor`.
+ */
 class BufferedRuntimeExecutor {
  public:
   using Work = std::function<void(jsi::Runtime& runtime)>;
 
-  // A utility structure to track pending work in the order of when they arrive.
-  struct BufferedWork {
-    uint64_t index_;
-    Work work_;
-    bool operator<(const BufferedWork& rhs) const {
-      // Higher index has lower priority, so this inverted comparison puts
-      // the smaller index on top of the queue.
-      return index_ > rhs.index_;
-    }
-  };
-
   BufferedRuntimeExecutor(RuntimeExecutor runtimeExecutor);
+  ~BufferedRuntimeExecutor();
+
+  BufferedRuntimeExecutor(const BufferedRuntimeExecutor&) = delete;
+  BufferedRuntimeExecutor& operator=(const BufferedRuntimeExecutor&) = delete;
 
-  void execute(Work&& callback);
+  /*
+   * Buffered work with a higher priority (e.g. `ImmediatePriority` for
+   * critical startup work) is replayed before work with a lower one.
+   * The priority has no effect once the executor has been flushed.
+   */
+  void execute(
+      Work&& callback,
+      SchedulerPriority priority = SchedulerPriority::NormalPriority);
 
-  // Flush buffered JS calls and then diable JS buffering
+  // Flush buffered JS calls and then disable JS buffering
   void flush();
 
  private:
-  // Perform flushing without locking mechanism
-  void unsafeFlush();
+  struct BufferedWork {
+    Work work;
+    SchedulerPriority priority;
+    BufferedWork* next;
+  };
+
+  // Submits the buffered list (newest first) as a single batch.
+  void flushList(BufferedWork* head);
+
+  static void executeSeparately(
+      const RuntimeExecutor& runtimeExecutor,
+      std::vector<Work>&& batch);
 
   RuntimeExecutor runtimeExecutor_;
-  std::atomic<bool> isBufferingEnabled_;
-  std::mutex lock_;
-  std::atomic<uint64_t> lastIndex_;
-  std::priority_queue<BufferedWork> queue_;
+
+  /*
+   * Head of the list of buffered work, newest first. Besides real entries, it
+   * can point to one of two sentinels: `flushing_` while `flush` is replaying
+   * work (new work is still buffered on top of it) and `closed_` once
+   * buffering is disabled. `nullptr` means buffering with nothing buffered.
+   */
+  std::atomic<BufferedWork*> head_{nullptr};
+  BufferedWork flushing_{};
+  BufferedWork closed_{};
+
+  // Serializes concurrent `flush` calls; `execute` never takes it.
+  std::mutex flushMutex_;
 };
 
 } // namespace facebook::react
@@ -37,6 +37,7 @@ ReactInstance::ReactInstance(
       jsMessageQueueThread_(jsMessageQueueThread),
       timerManager_(std::move(timerManager)),
       jsErrorHandler_(std::make_shared<JsErrorHandler>(std::move(onJsError))),
+      segmentLoader_(std::make_shared<SegmentLoader>()),
       parentInspectorTarget_(parentInspectorTarget) {
   RuntimeExecutor runtimeExecutor = [weakRuntime = std::weak_ptr(runtime_),
                                      weakTimerManager =
@@ -312,10 +313,14 @@ void ReactInstance::registerSegment(
     const std::string& segmentPath) {
   LOG(WARNING) << "Starting to run ReactInstance::registerSegment with segment "
                << segmentId;
-  runtimeScheduler_->scheduleWork([=](jsi::Runtime& runtime) {
+  // Start reading the segment right away, so it is likely in memory by the
+  // time the JS thread gets to it.
+  segmentLoader_->prefetch(segmentId, segmentPath);
+  runtimeScheduler_->scheduleWork([=, segmentLoader = segmentLoader_](
+                                      jsi::Runtime& runtime) {
     SystraceSection s("ReactInstance::registerSegment");
     const auto tag = folly::to<std::string>(segmentId);
-    auto script = JSBigFileString::fromPath(segmentPath);
+    auto script = segmentLoader->load(segmentId, segmentPath);
     if (script->size() == 0) {
       throw std::invalid_argument(
           "Empty segment registered with ID " + tag + " from " + segmentPath);
@@ -340,6 +345,12 @@ void ReactInstance::registerSegment(
   });
 }
 
+void ReactInstance::prefetchSegment(
+    uint32_t segmentId,
+    const std::string& segmentPath) {
+  segmentLoader_->prefetch(segmentId, segmentPath);
+}
+
 namespace {
 void defineReactInstanceFlags(
     jsi::Runtime& runtime,
@@ -16,6 +16,7 @@
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/runtime/BufferedRuntimeExecutor.h>
 #include <react/runtime/JSRuntimeFactory.h>
+#include <react/runtime/SegmentLoader.h>
 #include <react/runtime/TimerManager.h>
 
 namespace facebook::react {
@@ -53,6 +54,13 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
 
   void registerSegment(uint32_t segmentId, const std::string& segmentPath);
 
+  /**
+   * Starts loading a segment on a background thread ahead of its
+   * registration. Call this in the order the segments are expected to be
+   * registered, e.g. for the feature screens reachable from the current one.
+   */
+  void prefetchSegment(uint32_t segmentId, const std::string& segmentPath);
+
   void callFunctionOnModule(
       const std::string& moduleName,
       const std::string& methodName,
@@ -77,6 +85,7 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
       callableModules_;
   std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
   std::shared_ptr<JsErrorHandler> jsErrorHandler_;
+  std::shared_ptr<SegmentLoader> segmentLoader_;
 
   jsinspector_modern::InstanceTarget* inspectorTarget_{nullptr};
   jsinspector_modern::RuntimeTarget* runtimeInspectorTarget_{nullptr};
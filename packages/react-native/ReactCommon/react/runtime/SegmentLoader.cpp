@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SegmentLoader.h"
+
+#include <cxxreact/SystraceSection.h>
+#include <glog/logging.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace facebook::react {
+
+SegmentLoader::SegmentLoader(size_t concurrency)
+    : concurrency_(std::max<size_t>(concurrency, 1)) {}
+
+SegmentLoader::~SegmentLoader() {
+  {
+    std::scoped_lock lock(mutex_);
+    isStopping_ = true;
+  }
+  condition_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void SegmentLoader::prefetch(uint32_t segmentId, std::string segmentPath) {
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = segments_.find(segmentId);
+    if (it != segments_.end() && it->second->path == segmentPath) {
+      return;
+    }
+
+    auto segment = std::make_shared<PendingSegment>();
+    segment->path = std::move(segmentPath);
+    segment->status = Status::Queued;
+    segment->future = segment->promise.get_future();
+    segments_[segmentId] = std::move(segment);
+    queue_.push_back(segmentId);
+
+    // Threads are started lazily, so apps without segments don't pay for
+    // them.
+    if (threads_.size() < concurrency_ && threads_.size() < queue_.size()) {
+      threads_.emplace_back([this]() { workLoop(); });
+    }
+  }
+  condition_.notify_one();
+}
+
+std::unique_ptr<const JSBigString> SegmentLoader::load(
+    uint32_t segmentId,
+    const std::string& segmentPath) {
+  std::future<std::unique_ptr<const JSBigString>> future;
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = segments_.find(segmentId);
+    if (it != segments_.end() && it->second->path == segmentPath) {
+      // A segment still waiting in the queue behind other segments is
+      // loaded right here, which is faster than waiting. The worker skips
+      // segments that are no longer in `segments_`.
+      if (it->second->status == Status::Loading) {
+        future = std::move(it->second->future);
+      }
+      segments_.erase(it);
+    }
+  }
+
+  if (!future.valid()) {
+    return loadFromPath(segmentPath);
+  }
+
+  return future.get();
+}
+
+std::unique_ptr<const JSBigString> SegmentLoader::loadFromPath(
+    const std::string& segmentPath) {
+  SystraceSection s("SegmentLoader::loadFromPath");
+  auto script = JSBigFileString::fromPath(segmentPath);
+
+  // Map the file and fault its pages in now rather than while the JS thread
+  // parses it.
+  static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto data = script->c_str();
+  auto size = script->size();
+  volatile char sink = 0;
+  for (size_t offset = 0; offset < size; offset += pageSize) {
+    sink = sink + data[offset];
+  }
+
+  return script;
+}
+
+void SegmentLoader::workLoop() {
+  while (true) {
+    std::shared_ptr<PendingSegment> segment;
+    {
+      std::unique_lock lock(mutex_);
+      condition_.wait(lock, [this]() { return isStopping_ || !queue_.empty(); });
+      if (isStopping_) {
+        return;
+      }
+
+      auto segmentId = queue_.front();
+      queue_.pop_front();
+      auto it = segments_.find(segmentId);
+      if (it == segments_.end() || it->second->status != Status::Queued) {
+        // Already consumed by `load`, or re-registered and picked up.
+        continue;
+      }
+      segment = it->second;
+      segment->status = Status::Loading;
+    }
+
+    try {
+      segment->promise.set_value(loadFromPath(segment->path));
+    } catch (...) {
+      LOG(WARNING) << "SegmentLoader: Failed to prefetch " << segment->path;
+      segment->promise.set_exception(std::current_exception());
+    }
+  }
+}
+
+} // namespace facebook::react
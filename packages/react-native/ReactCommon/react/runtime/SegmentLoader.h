@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cxxreact/JSBigString.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Opens, maps and pages in bundle segments on background threads, so that
+ * evaluating a segment on the JS thread doesn't start with file I/O.
+ *
+ * Segments are prefetched in the order `prefetch` is called, by up to
+ * `concurrency` threads in parallel. `load` hands out a prefetched segment
+ * (waiting only for the remainder of an in-flight load) or loads it on the
+ * calling thread if it was never prefetched.
+ */
+class SegmentLoader final {
+ public:
+  explicit SegmentLoader(size_t concurrency = 2);
+  ~SegmentLoader();
+
+  SegmentLoader(const SegmentLoader&) = delete;
+  SegmentLoader& operator=(const SegmentLoader&) = delete;
+
+  /*
+   * Schedules a segment to be loaded in the background. No-op if the segment
+   * is already prefetched or being prefetched from the same path.
+   * Can be called from any thread.
+   */
+  void prefetch(uint32_t segmentId, std::string segmentPath);
+
+  /*
+   * Returns the content of the segment. Consumes the prefetched result, if
+   * any; throws if the file can't be loaded.
+   * Can be called from any thread.
+   */
+  std::unique_ptr<const JSBigString> load(
+      uint32_t segmentId,
+      const std::string& segmentPath);
+
+ private:
+  enum class Status { Queued, Loading };
+
+  struct PendingSegment {
+    std::string path;
+    Status status;
+    std::promise<std::unique_ptr<const JSBigString>> promise;
+    std::future<std::unique_ptr<const JSBigString>> future;
+  };
+
+  static std::unique_ptr<const JSBigString> loadFromPath(
+      const std::string& segmentPath);
+
+  void workLoop();
+
+  size_t concurrency_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::unordered_map<uint32_t, std::shared_ptr<PendingSegment>> segments_;
+  std::deque<uint32_t> queue_;
+  std::vector<std::thread> threads_;
+  bool isStopping_{false};
+};
+
+} // namespace facebook::react
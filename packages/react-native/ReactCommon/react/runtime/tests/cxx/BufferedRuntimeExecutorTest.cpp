@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/BufferedRuntimeExecutor.h>
+
+namespace facebook::react {
+
+class BufferedRuntimeExecutorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = hermes::makeHermesRuntime();
+    bufferedRuntimeExecutor_ = std::make_unique<BufferedRuntimeExecutor>(
+        [this](std::function<void(jsi::Runtime & runtime)>&& callback) {
+          std::scoped_lock lock(mutex_);
+          queue_.push(std::move(callback));
+        });
+  }
+
+  // Returns the number of times the runtime was entered.
+  int flushQueue() {
+    int entries = 0;
+    while (true) {
+      std::function<void(jsi::Runtime & runtime)> callback;
+      {
+        std::scoped_lock lock(mutex_);
+        if (queue_.empty()) {
+          return entries;
+        }
+        callback = std::move(queue_.front());
+        queue_.pop();
+      }
+      entries++;
+      callback(*runtime_);
+    }
+  }
+
+  std::unique_ptr<hermes::HermesRuntime> runtime_;
+  std::unique_ptr<BufferedRuntimeExecutor> bufferedRuntimeExecutor_;
+  std::mutex mutex_;
+  std::queue<std::function<void(jsi::Runtime & runtime)>> queue_;
+};
+
+TEST_F(BufferedRuntimeExecutorTest, testBuffersUntilFlush) {
+  std::vector<int> calls;
+  for (int i = 0; i < 100; i++) {
+    bufferedRuntimeExecutor_->execute(
+        [&calls, i](jsi::Runtime&) { calls.push_back(i); });
+  }
+
+  EXPECT_EQ(flushQueue(), 0);
+  EXPECT_TRUE(calls.empty());
+
+  bufferedRuntimeExecutor_->flush();
+
+  // All buffered work is replayed in a single entry, in order.
+  EXPECT_EQ(flushQueue(), 1);
+  ASSERT_EQ(calls.size(), 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(calls[i], i);
+  }
+
+  bufferedRuntimeExecutor_->execute(
+      [&calls](jsi::Runtime&) { calls.push_back(100); });
+  EXPECT_EQ(flushQueue(), 1);
+  EXPECT_EQ(calls.back(), 100);
+}
+
+TEST_F(BufferedRuntimeExecutorTest, testReplaysHigherPrioritiesFirst) {
+  std::vector<int> calls;
+  auto record = [&calls](int value) {
+    return [&calls, value](jsi::Runtime&) { calls.push_back(value); };
+  };
+
+  bufferedRuntimeExecutor_->execute(record(1));
+  bufferedRuntimeExecutor_->execute(
+      record(2), SchedulerPriority::ImmediatePriority);
+  bufferedRuntimeExecutor_->execute(record(3));
+  bufferedRuntimeExecutor_->execute(record(4), SchedulerPriority::IdlePriority);
+  bufferedRuntimeExecutor_->execute(
+      record(5), SchedulerPriority::ImmediatePriority);
+
+  bufferedRuntimeExecutor_->flush();
+  flushQueue();
+
+  EXPECT_EQ(calls, (std::vector<int>{2, 5, 1, 3, 4}));
+}
+
+TEST_F(BufferedRuntimeExecutorTest, testFailingWorkDoesNotDropTheRest) {
+  std::vector<int> calls;
+
+  bufferedRuntimeExecutor_->execute(
+      [&calls](jsi::Runtime&) { calls.push_back(1); });
+  bufferedRuntimeExecutor_->execute(
+      [](jsi::Runtime&) { throw std::runtime_error("failure"); });
+  bufferedRuntimeExecutor_->execute(
+      [&calls](jsi::Runtime&) { calls.push_back(3); });
+
+  bufferedRuntimeExecutor_->flush();
+
+  EXPECT_THROW(flushQueue(), std::runtime_error);
+  EXPECT_EQ(calls, (std::vector<int>{1}));
+
+  flushQueue();
+  EXPECT_EQ(calls, (std::vector<int>{1, 3}));
+}
+
+TEST_F(BufferedRuntimeExecutorTest, testConcurrentExecuteAndFlush) {
+  std::atomic<int> callCount{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 1000; i++) {
+        bufferedRuntimeExecutor_->execute(
+            [&callCount](jsi::Runtime&) { callCount++; });
+      }
+    });
+  }
+
+  bufferedRuntimeExecutor_->flush();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  flushQueue();
+
+  EXPECT_EQ(callCount, 4000);
+}
+
+} // namespace facebook::react
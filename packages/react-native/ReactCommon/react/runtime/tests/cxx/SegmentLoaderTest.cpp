@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <react/runtime/SegmentLoader.h>
+
+namespace facebook::react {
+
+class SegmentLoaderTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    for (const auto& path : paths_) {
+      std::remove(path.c_str());
+    }
+  }
+
+  std::string createSegment(const std::string& content) {
+    char path[] = "/tmp/SegmentLoaderTest-XXXXXX";
+    int fd = mkstemp(path);
+    EXPECT_NE(fd, -1);
+    EXPECT_EQ(
+        write(fd, content.data(), content.size()),
+        static_cast<ssize_t>(content.size()));
+    close(fd);
+    paths_.emplace_back(path);
+    return path;
+  }
+
+  static std::string toString(const std::unique_ptr<const JSBigString>& s) {
+    return std::string(s->c_str(), s->size());
+  }
+
+  std::vector<std::string> paths_;
+};
+
+TEST_F(SegmentLoaderTest, loadsSegmentThatWasNotPrefetched) {
+  auto path = createSegment("var a = 1;");
+  SegmentLoader loader;
+
+  EXPECT_EQ(toString(loader.load(1, path)), "var a = 1;");
+}
+
+TEST_F(SegmentLoaderTest, loadsPrefetchedSegments) {
+  SegmentLoader loader;
+  std::vector<std::string> paths;
+  for (int i = 0; i < 8; i++) {
+    paths.push_back(createSegment("var segment" + std::to_string(i) + ";"));
+    loader.prefetch(i, paths.back());
+  }
+
+  for (int i = 7; i >= 0; i--) {
+    EXPECT_EQ(
+        toString(loader.load(i, paths[i])),
+        "var segment" + std::to_string(i) + ";");
+  }
+}
+
+TEST_F(SegmentLoaderTest, prefetchedSegmentIsConsumedByLoad) {
+  auto path = createSegment("first");
+  SegmentLoader loader;
+  loader.prefetch(1, path);
+  EXPECT_EQ(toString(loader.load(1, path)), "first");
+
+  // Loading again must read the file again rather than reuse a stale result.
+  auto file = fopen(path.c_str(), "w");
+  fputs("second", file);
+  fclose(file);
+  EXPECT_EQ(toString(loader.load(1, path)), "second");
+}
+
+TEST_F(SegmentLoaderTest, ignoresPrefetchOfDifferentPath) {
+  auto prefetchedPath = createSegment("prefetched");
+  auto registeredPath = createSegment("registered");
+  SegmentLoader loader;
+  loader.prefetch(1, prefetchedPath);
+
+  EXPECT_EQ(toString(loader.load(1, registeredPath)), "registered");
+}
+
+TEST_F(SegmentLoaderTest, rethrowsLoadErrors) {
+  SegmentLoader loader;
+  loader.prefetch(1, "/nonexistent/segment.js");
+
+  EXPECT_THROW(loader.load(1, "/nonexistent/segment.js"), std::runtime_error);
+  EXPECT_THROW(loader.load(2, "/nonexistent/other.js"), std::runtime_error);
+}
+
+TEST_F(SegmentLoaderTest, destroysLoaderWithPendingPrefetches) {
+  auto loader = std::make_unique<SegmentLoader>(1);
+  for (int i = 0; i < 16; i++) {
+    loader->prefetch(i, createSegment("var x;"));
+  }
+  loader.reset();
+}
+
+} // namespace facebook::react
@@ -12,5 +12,6 @@ namespace facebook::react {
 bool CoreFeatures::enablePropIteratorSetter = false;
 bool CoreFeatures::enableGranularScrollViewStateUpdatesIOS = false;
 bool CoreFeatures::excludeYogaFromRawProps = false;
+bool CoreFeatures::enableShadowNodeAllocationPool = false;
 
 } // namespace facebook::react
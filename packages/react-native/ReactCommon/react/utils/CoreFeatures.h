@@ -25,6 +25,11 @@ class CoreFeatures {
 
   // When enabled, rawProps in Props will not include Yoga specific props.
   static bool excludeYogaFromRawProps;
+
+  // When enabled, the memory of shadow nodes and children lists is recycled
+  // through per-thread free lists instead of going back to `malloc`.
+  // Must be set before any shadow node is created.
+  static bool enableShadowNodeAllocationPool;
 };
 
 } // namespace facebook::react
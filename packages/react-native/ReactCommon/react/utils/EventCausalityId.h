@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Identifies the input event that caused a piece of work: the dispatch of
+ * the event itself, the tasks scheduled from it, and the commits (and
+ * mounting transactions) those tasks produce.
+ * The value is the `EventTag` assigned to the event by the `EventLogger`.
+ * Tracking the current event is done by `ScopedEventCausality` (in
+ * `react/renderer/runtimescheduler/EventCausality.h`).
+ */
+using EventCausalityId = uint32_t;
+
+constexpr EventCausalityId kNoEventCausality = 0;
+
+} // namespace facebook::react
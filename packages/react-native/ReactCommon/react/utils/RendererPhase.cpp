@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RendererPhase.h"
+
+#include <utility>
+
+namespace facebook::react {
+
+namespace {
+
+thread_local std::atomic<RendererPhase>* rendererPhaseWatcher = nullptr;
+
+} // namespace
+
+void setCurrentRendererPhase(RendererPhase rendererPhase) {
+  if (rendererPhaseWatcher != nullptr) {
+    rendererPhaseWatcher->store(rendererPhase, std::memory_order_relaxed);
+  }
+}
+
+std::atomic<RendererPhase>* setRendererPhaseWatcher(
+    std::atomic<RendererPhase>* watcher) {
+  return std::exchange(rendererPhaseWatcher, watcher);
+}
+
+} // namespace facebook::react
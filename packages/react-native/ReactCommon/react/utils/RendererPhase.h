@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Phase of the rendering pipeline a thread is in.
+ */
+enum class RendererPhase : uint8_t {
+  None,
+  Commit,
+  Layout,
+  TextMeasure,
+  Diff,
+  Mount,
+};
+
+/*
+ * Reports the phase of the rendering pipeline the current thread entered to
+ * the watcher of the thread (see `setRendererPhaseWatcher`), if any. Cheap
+ * enough to be called on every transition.
+ */
+void setCurrentRendererPhase(RendererPhase rendererPhase);
+
+/*
+ * Makes `setCurrentRendererPhase` store the phases of the current thread in
+ * `watcher` (or nowhere, if it's `nullptr`). Returns the previous watcher.
+ */
+std::atomic<RendererPhase>* setRendererPhaseWatcher(
+    std::atomic<RendererPhase>* watcher);
+
+} // namespace facebook::react
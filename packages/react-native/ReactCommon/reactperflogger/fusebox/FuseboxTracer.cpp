@@ -14,9 +14,65 @@
 
 namespace facebook::react {
 
+/*
+ * Single-producer, single-consumer ring of events recorded by one thread.
+ * The owning thread pushes without taking any lock; `FuseboxTracer` drains
+ * it under `mutex_`.
+ */
+class FuseboxTracer::ThreadBuffer final {
+ public:
+  ThreadBuffer() : events_(kThreadBufferCapacity) {}
+
+  // Called by the owning thread only.
+  void push(const BufferEvent& event) {
+    auto head = head_.load(std::memory_order_relaxed);
+    auto tail = tail_.load(std::memory_order_acquire);
+    if (head - tail == events_.size()) {
+      droppedEventCount_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    events_[head % events_.size()] = event;
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  // Called by the consumer only.
+  template <typename CallbackT>
+  void drain(CallbackT&& callback) {
+    auto head = head_.load(std::memory_order_acquire);
+    auto tail = tail_.load(std::memory_order_relaxed);
+    for (; tail != head; tail++) {
+      callback(events_[tail % events_.size()]);
+    }
+    tail_.store(head, std::memory_order_release);
+  }
+
+  // Called by the consumer only.
+  size_t takeDroppedEventCount() {
+    return droppedEventCount_.exchange(0, std::memory_order_relaxed);
+  }
+
+  // Names and tracks this thread has already interned. Owning thread only.
+  std::unordered_map<std::string_view, uint32_t> internedIds;
+
+ private:
+  std::vector<BufferEvent> events_;
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<size_t> droppedEventCount_{0};
+};
+
+namespace {
+
+uint64_t timePointToMicroseconds(FuseboxTracer::TimePoint timePoint) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             timePoint.time_since_epoch())
+      .count();
+}
+
+} // namespace
+
 bool FuseboxTracer::isTracing() {
-  std::lock_guard lock(mutex_);
-  return tracing_;
+  return tracing_.load(std::memory_order_relaxed);
 }
 
 bool FuseboxTracer::startTracing() {
@@ -24,6 +80,14 @@ bool FuseboxTracer::startTracing() {
   if (tracing_) {
     return false;
   }
+
+  // Discards events recorded by threads that raced with the end of the
+  // previous session.
+  for (auto& threadBuffer : threadBuffers_) {
+    threadBuffer->drain([](const BufferEvent& /*event*/) {});
+    threadBuffer->takeDroppedEventCount();
+  }
+
   tracing_ = true;
   return true;
 }
@@ -38,49 +102,74 @@ bool FuseboxTracer::stopTracing(
   }
 
   tracing_ = false;
-  if (buffer_.empty()) {
-    return true;
-  }
 
   auto traceEvents = folly::dynamic::array();
-  auto savedBuffer = std::move(buffer_);
-  buffer_.clear();
+  auto flush = [&]() {
+    resultCallback(traceEvents);
+    traceEvents = folly::dynamic::array();
+  };
 
-  std::unordered_map<std::string, uint64_t> trackIdMap;
+  std::unordered_map<uint32_t, uint64_t> trackIdMap;
   uint64_t nextTrack = 1000;
+  size_t droppedEventCount = 0;
 
-  // Name the main process. Only one process is supported currently.
-  traceEvents.push_back(folly::dynamic::object(
-      "args", folly::dynamic::object("name", "Main App"))("cat", "__metadata")(
-      "name", "process_name")("ph", "M")("pid", 1000)("tid", 0)("ts", 0));
-
-  for (auto& event : savedBuffer) {
-    if (!trackIdMap.contains(event.track)) {
-      auto trackId = nextTrack++;
-      trackIdMap[event.track] = trackId;
-      // New track
-      traceEvents.push_back(folly::dynamic::object(
-          "args", folly::dynamic::object("name", event.track))(
-          "cat", "__metadata")("name", "thread_name")("ph", "M")("pid", 1000)(
-          "tid", trackId)("ts", 0));
-    }
-    auto trackId = trackIdMap[event.track];
+  {
+    std::shared_lock internLock(internMutex_);
 
-    // New event
-    traceEvents.push_back(folly::dynamic::object(
-        "args", folly::dynamic::object())("cat", "react.native")(
-        "dur", (event.end - event.start) * 1000)("name", event.name)("ph", "X")(
-        "ts", event.start * 1000)("pid", 1000)("tid", trackId));
+    for (auto& threadBuffer : threadBuffers_) {
+      threadBuffer->drain([&](const BufferEvent& event) {
+        if (trackIdMap.empty()) {
+          // Name the main process. Only one process is supported currently.
+          traceEvents.push_back(folly::dynamic::object(
+              "args", folly::dynamic::object("name", "Main App"))(
+              "cat", "__metadata")("name", "process_name")("ph", "M")(
+              "pid", 1000)("tid", 0)("ts", 0));
+        }
+
+        auto trackIdIterator = trackIdMap.find(event.track);
+        if (trackIdIterator == trackIdMap.end()) {
+          auto trackId = nextTrack++;
+          trackIdIterator = trackIdMap.emplace(event.track, trackId).first;
+          // New track
+          traceEvents.push_back(folly::dynamic::object(
+              "args",
+              folly::dynamic::object("name", internedStrings_[event.track]))(
+              "cat", "__metadata")("name", "thread_name")("ph", "M")(
+              "pid", 1000)("tid", trackId)("ts", 0));
+        }
 
-    if (traceEvents.size() >= 1000) {
-      resultCallback(traceEvents);
-      traceEvents = folly::dynamic::array();
+        // New event
+        traceEvents.push_back(folly::dynamic::object(
+            "args", folly::dynamic::object())("cat", "react.native")(
+            "dur", event.end - event.start)(
+            "name", internedStrings_[event.name])("ph", "X")(
+            "ts", event.start)("pid", 1000)("tid", trackIdIterator->second));
+
+        if (traceEvents.size() >= kMaxEventsPerChunk) {
+          flush();
+        }
+      });
+
+      droppedEventCount += threadBuffer->takeDroppedEventCount();
     }
   }
 
+  if (droppedEventCount > 0) {
+    traceEvents.push_back(folly::dynamic::object(
+        "args", folly::dynamic::object("droppedEventCount", droppedEventCount))(
+        "cat", "react.native")("name", "FuseboxTracer buffer overflow")(
+        "ph", "i")("s", "g")("ts", 0)("pid", 1000)("tid", 0));
+  }
+
   if (traceEvents.size() >= 1) {
-    resultCallback(traceEvents);
+    flush();
   }
+
+  // Buffers of threads that have exited are only referenced from here.
+  std::erase_if(threadBuffers_, [](const auto& threadBuffer) {
+    return threadBuffer.use_count() == 1;
+  });
+
   return true;
 }
 
@@ -89,12 +178,74 @@ void FuseboxTracer::addEvent(
     uint64_t start,
     uint64_t end,
     const std::string_view& track) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!tracing_) {
+  recordEvent(name, start * 1000, end * 1000, track);
+}
+
+void FuseboxTracer::addEvent(
+    const std::string_view& name,
+    TimePoint start,
+    TimePoint end,
+    const std::string_view& track) {
+  recordEvent(
+      name,
+      timePointToMicroseconds(start),
+      timePointToMicroseconds(end),
+      track);
+}
+
+void FuseboxTracer::recordEvent(
+    const std::string_view& name,
+    uint64_t start,
+    uint64_t end,
+    const std::string_view& track) {
+  if (!isTracing()) {
     return;
   }
-  buffer_.push_back(
-      BufferEvent{start, end, std::string(name), std::string(track)});
+
+  auto& threadBuffer = getThreadBuffer();
+  threadBuffer.push(BufferEvent{
+      start,
+      end,
+      intern(threadBuffer, name),
+      intern(threadBuffer, track)});
+}
+
+FuseboxTracer::ThreadBuffer& FuseboxTracer::getThreadBuffer() {
+  thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+  if (!threadBuffer) {
+    threadBuffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard lock(mutex_);
+    threadBuffers_.push_back(threadBuffer);
+  }
+  return *threadBuffer;
+}
+
+uint32_t FuseboxTracer::intern(
+    ThreadBuffer& threadBuffer,
+    const std::string_view& string) {
+  auto iterator = threadBuffer.internedIds.find(string);
+  if (iterator != threadBuffer.internedIds.end()) {
+    return iterator->second;
+  }
+
+  auto id = uint32_t{0};
+  auto internedString = std::string_view{};
+  {
+    std::unique_lock lock(internMutex_);
+    auto globalIterator = internedIds_.find(string);
+    if (globalIterator != internedIds_.end()) {
+      id = globalIterator->second;
+      internedString = globalIterator->first;
+    } else {
+      id = static_cast<uint32_t>(internedStrings_.size());
+      // `std::deque` never moves its elements, so views stay valid.
+      internedString = internedStrings_.emplace_back(string);
+      internedIds_.emplace(internedString, id);
+    }
+  }
+
+  threadBuffer.internedIds.emplace(internedString, id);
+  return id;
 }
 
 bool FuseboxTracer::stopTracingAndWriteToFile(const std::string& path) {
@@ -7,21 +7,45 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include "folly/dynamic.h"
 
 namespace facebook::react {
 
 struct BufferEvent {
+  // Microseconds on the `std::chrono::steady_clock` timeline.
   uint64_t start;
   uint64_t end;
-  std::string name;
-  std::string track;
+  // Interned by `FuseboxTracer`.
+  uint32_t name;
+  uint32_t track;
 };
 
 class FuseboxTracer {
  public:
+  using TimePoint = std::chrono::steady_clock::time_point;
+
+  /*
+   * Number of events each recording thread can buffer during one tracing
+   * session. Events recorded after a thread's buffer is full are dropped.
+   */
+  static constexpr size_t kThreadBufferCapacity = 8192;
+
+  /*
+   * Maximum number of trace events passed to one `stopTracing` callback.
+   */
+  static constexpr size_t kMaxEventsPerChunk = 1000;
+
   FuseboxTracer(const FuseboxTracer&) = delete;
 
   bool isTracing();
@@ -31,23 +55,62 @@ class FuseboxTracer {
   // Verifies that we're tracing and dumps the trace all in one step to avoid
   // TOCTOU bugs. Returns false if we're not tracing. No result callbacks
   // are expected in that scenario.
+  // Chunks are serialized one at a time straight from the thread buffers.
   bool stopTracing(const std::function<void(const folly::dynamic& eventsChunk)>&
                        resultCallback);
   bool stopTracingAndWriteToFile(const std::string& path);
+
+  /*
+   * Records an event with `start` and `end` in milliseconds, as reported by
+   * `performance.now()`.
+   * Never blocks on other recording threads.
+   */
   void addEvent(
       const std::string_view& name,
       uint64_t start,
       uint64_t end,
       const std::string_view& track);
 
+  /*
+   * Records an event with high-resolution time points, for native
+   * instrumentation.
+   */
+  void addEvent(
+      const std::string_view& name,
+      TimePoint start,
+      TimePoint end,
+      const std::string_view& track);
+
   static FuseboxTracer& getFuseboxTracer();
 
  private:
+  class ThreadBuffer;
+
   FuseboxTracer() {}
 
-  bool tracing_{false};
-  std::vector<BufferEvent> buffer_;
+  void recordEvent(
+      const std::string_view& name,
+      uint64_t start,
+      uint64_t end,
+      const std::string_view& track);
+
+  ThreadBuffer& getThreadBuffer();
+  uint32_t intern(ThreadBuffer& threadBuffer, const std::string_view& string);
+
+  std::atomic<bool> tracing_{false};
+
+  // Serializes starting and stopping (the only consumer of the thread
+  // buffers) and the registration of new thread buffers.
   std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>>
+      threadBuffers_; // Protected by `mutex_`.
+
+  // Only taken when a thread sees a name or track for the first time, and
+  // while serializing.
+  std::shared_mutex internMutex_;
+  std::deque<std::string> internedStrings_; // Protected by `internMutex_`.
+  std::unordered_map<std::string_view, uint32_t>
+      internedIds_; // Protected by `internMutex_`.
 };
 
 } // namespace facebook::react
@@ -5,6 +5,9 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <reactperflogger/fusebox/FuseboxTracer.h>
@@ -87,4 +90,78 @@ TEST_F(FuseboxTracerTest, ShouldEndTracingEvenIfThereIsNoEvents) {
   EXPECT_FALSE(FuseboxTracer::getFuseboxTracer().isTracing());
 }
 
+TEST_F(FuseboxTracerTest, EventsFromMultipleThreads) {
+  FuseboxTracer::getFuseboxTracer().startTracing();
+  auto threads = std::vector<std::thread>{};
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([i]() {
+      for (int j = 0; j < 100; j++) {
+        FuseboxTracer::getFuseboxTracer().addEvent(
+            "test", 0, 1, i % 2 == 0 ? "even track" : "odd track");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto trace = stopTracingAndCollect();
+  auto eventCount = 0;
+  auto trackNames = std::vector<std::string>{};
+  for (const auto& event : trace) {
+    if (event["ph"] == "X") {
+      eventCount++;
+      EXPECT_EQ(event["name"], "test");
+      EXPECT_EQ(event["dur"], 1000);
+    } else if (event["name"] == "thread_name") {
+      trackNames.push_back(event["args"]["name"].asString());
+    }
+  }
+  EXPECT_EQ(eventCount, 400);
+  // Each track is described once, no matter how many threads used it.
+  EXPECT_EQ(trackNames.size(), 2);
+}
+
+TEST_F(FuseboxTracerTest, HighResolutionEvents) {
+  FuseboxTracer::getFuseboxTracer().startTracing();
+  auto start = FuseboxTracer::TimePoint{std::chrono::microseconds(1500)};
+  FuseboxTracer::getFuseboxTracer().addEvent(
+      "native", start, start + std::chrono::microseconds(250), "native track");
+
+  auto trace = stopTracingAndCollect();
+  auto found = false;
+  for (const auto& event : trace) {
+    if (event["ph"] == "X") {
+      EXPECT_EQ(event["ts"], 1500);
+      EXPECT_EQ(event["dur"], 250);
+      found = true;
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST_F(FuseboxTracerTest, StreamsChunksAndDropsOverflow) {
+  FuseboxTracer::getFuseboxTracer().startTracing();
+  auto eventCount = FuseboxTracer::kThreadBufferCapacity + 10;
+  for (size_t i = 0; i < eventCount; i++) {
+    FuseboxTracer::getFuseboxTracer().addEvent("test", 0, 0, "default track");
+  }
+
+  auto chunkCount = 0;
+  auto droppedEventCount = 0;
+  FuseboxTracer::getFuseboxTracer().stopTracing(
+      [&](const folly::dynamic& eventsChunk) {
+        chunkCount++;
+        EXPECT_LE(eventsChunk.size(), FuseboxTracer::kMaxEventsPerChunk);
+        for (const auto& event : eventsChunk) {
+          if (event["ph"] == "i") {
+            droppedEventCount = event["args"]["droppedEventCount"].asInt();
+          }
+        }
+      });
+
+  EXPECT_GT(chunkCount, 1);
+  EXPECT_EQ(droppedEventCount, 10);
+}
+
 } // namespace facebook::react
@@ -11,7 +11,14 @@
 // flowlint unsafe-getters-setters:off
 
 export type DOMHighResTimeStamp = number;
-export type PerformanceEntryType = 'mark' | 'measure' | 'event' | 'longtask';
+// 'stall' is specific to React Native: the JavaScript thread was found blocked
+// by a task that was still running.
+export type PerformanceEntryType =
+  | 'mark'
+  | 'measure'
+  | 'event'
+  | 'longtask'
+  | 'stall';
 
 export type PerformanceEntryJSON = {
   name: string,
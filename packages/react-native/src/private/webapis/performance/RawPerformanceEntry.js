@@ -24,6 +24,7 @@ export const RawPerformanceEntryTypeValues = {
   MEASURE: 2,
   EVENT: 3,
   LONGTASK: 4,
+  STALL: 5,
 };
 
 export function rawToPerformanceEntry(
@@ -76,6 +77,8 @@ export function rawToPerformanceEntryType(
       return 'event';
     case RawPerformanceEntryTypeValues.LONGTASK:
       return 'longtask';
+    case RawPerformanceEntryTypeValues.STALL:
+      return 'stall';
     default:
       throw new TypeError(
         `rawToPerformanceEntryType: unexpected performance entry type received: ${type}`,
@@ -95,6 +98,8 @@ export function performanceEntryTypeToRaw(
       return RawPerformanceEntryTypeValues.EVENT;
     case 'longtask':
       return RawPerformanceEntryTypeValues.LONGTASK;
+    case 'stall':
+      return RawPerformanceEntryTypeValues.STALL;
     default:
       // Verify exhaustive check with Flow
       (type: empty);